@@ -5,6 +5,7 @@
 #include "RadicalMovementComponent.h"
 #include "InputBufferSubsystem.h"
 #include "Debug/CFW_LOG.h"
+#include "RootMotionTasks/RootMotionTask_Base.h"
 
 
 /* Define default component object names */
@@ -515,11 +516,11 @@ void ARadicalCharacter::CreateBasedMovementInfo(FBasedMovementInfo& BasedMovemen
 		const bool bBaseIsSimulating = MovementBaseUtility::IsSimulatedBase(BaseComponent);
 		if (bBaseChanged)
 		{
-			MovementBaseUtility::RemoveTickDependency(MovementComponent->PrimaryComponentTick, OldBase);
+			MovementComponent->RemoveMovementBaseTickDependency(OldBase);
 			/* Use special post physics function if simulating, otherwise add normal tick prereqs. */
 			if (!bBaseIsSimulating)
 			{
-				MovementBaseUtility::AddTickDependency(MovementComponent->PrimaryComponentTick, BaseComponent);
+				MovementComponent->AddMovementBaseTickDependency(BaseComponent);
 			}
 		}
 
@@ -671,4 +672,30 @@ bool ARadicalCharacter::HasAnyRootMotion() const
 	return false;
 }
 
-#pragma endregion Animation Interface
\ No newline at end of file
+#pragma endregion Animation Interface
+
+#pragma region Root Motion Tasks Interface
+
+void ARadicalCharacter::ReleaseRootMotionTask(URootMotionTask_Base* Task)
+{
+	if (!Task || Task->bPooled) return;
+	
+	Task->ResetTask();
+	Task->bPooled = true;
+	Task->Generation++;
+}
+
+URootMotionTask_Base* ARadicalCharacter::RecycleRootMotionTask(const UClass* TaskClass)
+{
+	for (URootMotionTask_Base* Task : RootMotionTasks)
+	{
+		if (Task && Task->bPooled && Task->GetClass() == TaskClass)
+		{
+			Task->bPooled = false;
+			return Task;
+		}
+	}
+	return nullptr;
+}
+
+#pragma endregion Root Motion Tasks Interface
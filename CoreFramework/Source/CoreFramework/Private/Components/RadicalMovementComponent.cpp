@@ -1,11 +1,13 @@
 // Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
 #include "RadicalMovementComponent.h"
 #include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
 #include "Debug/RMC_LOG.h"
 #include "CFW_PCH.h"
 #include "CharacterMovementComponentAsync.h"
 #include "RadicalCharacter.h"
 #include "StaticLibraries/CoreMathLibrary.h"
+#include "Subsystems/RadicalMovementSubsystem.h"
 #include "VisualLogger/VisualLogger.h"
 
 #pragma region Profiling & CVars
@@ -29,20 +31,73 @@ DECLARE_CYCLE_STAT(TEXT("Step Up"), STAT_StepUp, STATGROUP_RadicalMovementComp)
 /* Events */
 DECLARE_CYCLE_STAT(TEXT("Calculate Velocity"), STAT_CalcVel, STATGROUP_RadicalMovementComp)
 DECLARE_CYCLE_STAT(TEXT("Update Rotation"), STAT_UpdateRot, STATGROUP_RadicalMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Batched Velocities Used"), STAT_BatchedVelocitiesUsed, STATGROUP_RadicalMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Batched Velocities Rejected"), STAT_BatchedVelocitiesRejected, STATGROUP_RadicalMovementComp)
 
 
 /* Hit Queries */
 DECLARE_CYCLE_STAT(TEXT("Find Floor"), STAT_FindFloor, STATGROUP_RadicalMovementComp)
 DECLARE_CYCLE_STAT(TEXT("Process Landed"), STAT_ProcessLanded, STATGROUP_RadicalMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Async Floor Probes Used"), STAT_AsyncFloorProbesUsed, STATGROUP_RadicalMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Async Floor Probes Rejected"), STAT_AsyncFloorProbesRejected, STATGROUP_RadicalMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Floor Cache Hits"), STAT_FloorCacheHits, STATGROUP_RadicalMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Floor Cache Misses"), STAT_FloorCacheMisses, STATGROUP_RadicalMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Movement LOD Skipped Updates"), STAT_MovementLODSkippedUpdates, STATGROUP_RadicalMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Fixed Steps"), STAT_FixedSteps, STATGROUP_RadicalMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Fixed Steps Dropped"), STAT_FixedStepsDropped, STATGROUP_RadicalMovementComp)
 
 /* Features */
 DECLARE_CYCLE_STAT(TEXT("Tick Pose"), STAT_TickPose, STATGROUP_RadicalMovementComp)
 DECLARE_CYCLE_STAT(TEXT("Apply Root Motion"), STAT_RootMotion, STATGROUP_RadicalMovementComp)
 DECLARE_CYCLE_STAT(TEXT("Move With Base"), STAT_MoveWithBase, STATGROUP_RadicalMovementComp)
 DECLARE_CYCLE_STAT(TEXT("Physics Interaction"), STAT_PhysicsInteraction, STATGROUP_RadicalMovementComp)
+DECLARE_CYCLE_STAT(TEXT("Predict Trajectory"), STAT_PredictTrajectory, STATGROUP_RadicalMovementComp)
+
+/* Scene Query Instrumentation, attributes the queries issued within the scope to the given EMovementQuerySite */
+#if RMC_QUERY_STATS
+	#define RMC_QUERY_SITE(Site) TGuardValue<EMovementQuerySite> QuerySiteScope(const_cast<URadicalMovementComponent*>(this)->CurrentQuerySite, EMovementQuerySite::Site);
+#else
+	#define RMC_QUERY_SITE(Site)
+#endif
 
 namespace RMCCVars
 {
+	int32 AsyncFloorProbes = 1;
+	FAutoConsoleVariableRef CVarAsyncFloorProbes
+	(
+		TEXT("rmc.AsyncFloorProbes"),
+		AsyncFloorProbes,
+		TEXT("Issue async floor probes for components with bUseAsyncFloorProbes. 0: Disable, 1: Enable"),
+		ECVF_Default
+	);
+
+	int32 FloorCache = 1;
+	FAutoConsoleVariableRef CVarFloorCache
+	(
+		TEXT("rmc.FloorCache"),
+		FloorCache,
+		TEXT("Reuse cached floor results for components with bUseFloorCache. 0: Disable, 1: Enable"),
+		ECVF_Default
+	);
+
+	int32 MovementLOD = 1;
+	FAutoConsoleVariableRef CVarMovementLOD
+	(
+		TEXT("rmc.MovementLOD"),
+		MovementLOD,
+		TEXT("Apply movement LOD tiers. 0: Disable (Always update at full rate), 1: Enable"),
+		ECVF_Default
+	);
+
+	int32 ForceMovementLOD = -1;
+	FAutoConsoleVariableRef CVarForceMovementLOD
+	(
+		TEXT("rmc.ForceMovementLOD"),
+		ForceMovementLOD,
+		TEXT("Force every component to the given movement LOD tier. -1: Evaluate from significance, >= 0: Tier"),
+		ECVF_Default
+	);
+	
 #if ALLOW_CONSOLE && !NO_LOGGING
 	int32 EnableVLog = 0;
 	FAutoConsoleVariableRef CVarEnableVLog
@@ -121,6 +176,16 @@ URadicalMovementComponent::URadicalMovementComponent()
 	MaxSimulationIterations = 8;
 	MaxDepenetrationWithGeometry = 500.f;
 	MaxDepenetrationWithPawn = 100.f;
+	bAllowBatchedMovement = true;
+	bMovementBatched = false;
+	bUseFixedTimestep = false;
+	bInterpolateFixedTimestep = true;
+	FixedTimestep = 1.f / 60.f;
+	MaxFixedStepsPerFrame = 4;
+	FixedTimestepAccumulator = 0.f;
+	PreviousSimulatedLocation = FVector::ZeroVector;
+	PreviousSimulatedRotation = FQuat::Identity;
+	bHasSimulatedFixedStep = false;
 	
 	// Set Ground Detection Defaults
 	StabilityOrientationMode = MODE_Gravity;
@@ -129,6 +194,32 @@ URadicalMovementComponent::URadicalMovementComponent()
 	bAlwaysCheckFloor = true;
 	bForceNextFloorCheck = true;
 	bUseFlatBaseForFloorChecks = false;
+	bUseAsyncFloorProbes = false;
+	AsyncFloorProbeTolerance = 5.f;
+	bUseFloorCache = false;
+	FloorCacheDistanceThreshold = 0.5f;
+	FloorCacheMaxAge = 0.25f;
+
+	// Set Movement LOD Defaults
+	OffscreenLODDistanceScale = 2.f;
+	MovementLODEvaluationInterval = 0.25f;
+	MaxMovementLODSmoothingDistance = 250.f;
+	CurrentMovementLOD = INDEX_NONE;
+	ForcedMovementLOD = INDEX_NONE;
+	MovementLODEvaluationTime = 0.f;
+	MovementLODAccumulatedTime = 0.f;
+	MovementLODSmoothingOffset = FVector::ZeroVector;
+	MovementLODSmoothingTime = 0.f;
+	MovementLODSmoothingDuration = 0.f;
+	bMovementLODSmoothing = false;
+	MovementLODVisualOffset = FVector::ZeroVector;
+	FixedTimestepVisualOffset = FVector::ZeroVector;
+	FixedTimestepVisualRotation = FQuat::Identity;
+	bMeshVisualOffsetApplied = false;
+
+	// Set Scene Query Instrumentation Defaults
+	CurrentQuerySite = EMovementQuerySite::Move;
+	NumQueryUpdates = 0;
 	MaxStepHeight = 45.f;
 	
 	
@@ -162,6 +253,10 @@ URadicalMovementComponent::URadicalMovementComponent()
 	InitialPushForceFactor = 500.f;
 	PushForceFactor = 750000.f;
 	PushForcePointVerticalOffsetFactor = -0.75f;
+	bEnablePawnRepulsion = false;
+	PawnRepulsionStrength = 800.f;
+	PawnRepulsionRadiusScale = 1.2f;
+	RepulsionIndex = INDEX_NONE;
 
 	// Set MovingBase Defaults
 	bMoveWithBase = true;
@@ -206,6 +301,31 @@ void URadicalMovementComponent::BeginPlay()
 	Super::BeginPlay();
 	PhysicsState = STATE_Grounded;
 
+	// Spawning doesn't go through OnTeleported, the mesh would otherwise interpolate from the origin
+	ResetFixedTimestepInterpolation();
+
+	AsyncFloorProbeDelegate.BindUObject(this, &URadicalMovementComponent::OnAsyncFloorProbeCompleted);
+
+	// Spread LOD evaluations of pawns spawned together across frames
+	MovementLODEvaluationTime = FMath::FRand() * MovementLODEvaluationInterval;
+
+	// Hand the tick over to the movement batch if enabled
+	if (bAllowBatchedMovement && URadicalMovementSubsystem::IsBatchingEnabled())
+	{
+		if (URadicalMovementSubsystem* MovementSubsystem = GetWorld()->GetSubsystem<URadicalMovementSubsystem>())
+		{
+			MovementSubsystem->RegisterComponent(this);
+		}
+	}
+
+	if (bEnablePawnRepulsion)
+	{
+		if (URadicalMovementSubsystem* MovementSubsystem = GetWorld()->GetSubsystem<URadicalMovementSubsystem>())
+		{
+			MovementSubsystem->RegisterRepulsionComponent(this);
+		}
+	}
+
 	// Check if MovementData was supplied
 	if (!MovementData)
 	{
@@ -213,6 +333,27 @@ void URadicalMovementComponent::BeginPlay()
 	}
 }
 
+void URadicalMovementComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bMovementBatched)
+	{
+		if (URadicalMovementSubsystem* MovementSubsystem = GetWorld()->GetSubsystem<URadicalMovementSubsystem>())
+		{
+			MovementSubsystem->UnregisterComponent(this);
+		}
+	}
+
+	if (RepulsionIndex != INDEX_NONE)
+	{
+		if (URadicalMovementSubsystem* MovementSubsystem = GetWorld()->GetSubsystem<URadicalMovementSubsystem>())
+		{
+			MovementSubsystem->UnregisterRepulsionComponent(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void URadicalMovementComponent::PostLoad()
 {
 	Super::PostLoad();
@@ -237,13 +378,41 @@ void URadicalMovementComponent::TickComponent(float DeltaTime, ELevelTick TickTy
 	SCOPED_NAMED_EVENT(URadicalMovementComponent_TickComponent, FColor::Yellow)
 	SCOPE_CYCLE_COUNTER(STAT_TickComponent)
 
-	InputVector = ConsumeInputVector();
+	if (!ConsumeMovementLODTime(DeltaTime))
+	{
+		return;
+	}
+
 	const FVector OldVelocity = Velocity;
 
-	if (ShouldSkipUpdate(DeltaTime))
+	if (!PreTickMovement(DeltaTime, TickType, ThisTickFunction))
 	{
 		return;
 	}
+	
+	/* Store Previous Mesh and Root info for trajectory visualization (separate from LastUpdateLocation since we never have proper access to it here)*/
+	const FVector OldRootLocation = UpdatedComponent->GetComponentLocation();
+	
+	/* Perform Move */
+	const float SimulatedTime = SimulateMovement(DeltaTime);
+
+	/* Set Delta Values */
+	if (SimulatedTime != 0.f)
+	{
+		PhysicalAcceleration = (Velocity - OldVelocity) / SimulatedTime;
+	}
+
+	PostTickMovement(DeltaTime, OldRootLocation);
+}
+
+bool URadicalMovementComponent::PreTickMovement(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	InputVector = ConsumeInputVector();
+
+	if (ShouldSkipUpdate(DeltaTime))
+	{
+		return false;
+	}
 
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
@@ -252,7 +421,7 @@ void URadicalMovementComponent::TickComponent(float DeltaTime, ELevelTick TickTy
 	/* Check if we fell out of the world*/
 	if (bIsSimulatingPhysics && !PawnOwner->CheckStillInWorld())
 	{
-		return;
+		return false;
 	}
 	
 	/* Don't update if simulating physics (e.g ragdolls) */
@@ -264,32 +433,42 @@ void URadicalMovementComponent::TickComponent(float DeltaTime, ELevelTick TickTy
 			BodyInstance->SetLinearVelocity(GetVelocity(), false);
 		}
 		ClearAccumulatedForces(); // Maybe
-		return;
+		return false;
 	}
-	
-	/* Store Previous Mesh and Root info for trajectory visualization (separate from LastUpdateLocation since we never have proper access to it here)*/
-	const FVector OldRootLocation = UpdatedComponent->GetComponentLocation();
-	
-	/* Perform Move */
-	PerformMovement(DeltaTime);
+
+	return true;
+}
+
+void URadicalMovementComponent::PostTickMovement(float DeltaTime, const FVector& OldRootLocation)
+{
+	const FMovementLODTier* LODTier = GetMovementLODTier();
+
+	/* Hide the reduced update rate of the movement LOD */
+	StartMovementLODSmoothing(OldRootLocation);
 	
 	/* Physics interactions updates */
-	if (bEnablePhysicsInteraction)
+	if (bEnablePhysicsInteraction && (!LODTier || LODTier->bPhysicsInteraction))
 	{
 		SCOPE_CYCLE_COUNTER(STAT_PhysicsInteraction)
 		ApplyDownwardForce(DeltaTime);
 		ApplyRepulsionForce(DeltaTime);
 	}
-
-	/* Set Delta Values */
-	if (DeltaTime != 0.f)
+	if (bEnablePawnRepulsion && (!LODTier || LODTier->bPhysicsInteraction))
 	{
-		PhysicalAcceleration = (Velocity - OldVelocity) / DeltaTime;
+		ApplyPawnRepulsion(DeltaTime);
 	}
 
+	/* Probe ahead for the floor check of the next update */
+	IssueAsyncFloorProbe(DeltaTime);
+
+	/* Queries issued outside of the update (e.g based movement) are counted towards the next one */
+#if RMC_QUERY_STATS
+	FlushSceneQueryCounts();
+#endif
+
 	/* Nice extra debug visualizer should add eventually from CMC */
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-	const bool bVisualizeMovement = RMCCVars::VisualizeMovement > 0;
+	const bool bVisualizeMovement = RMCCVars::VisualizeMovement > 0 && (!LODTier || LODTier->bDebugVisualization);
 	if (bVisualizeMovement)
 	{
 		VisualizeMovement();
@@ -367,6 +546,19 @@ void URadicalMovementComponent::SetUpdatedComponent(USceneComponent* NewUpdatedC
 	{
 		UpdatedPrimitive->OnComponentBeginOverlap.AddUniqueDynamic(this, &URadicalMovementComponent::RootCollisionTouched);
 	}
+
+	ResetFixedTimestepInterpolation();
+}
+
+bool URadicalMovementComponent::MoveUpdatedComponentImpl(const FVector& Delta, const FQuat& NewRotation, bool bSweep, FHitResult* OutHit, ETeleportType Teleport)
+{
+	/* Zero delta moves only update the rotation, the primitive doesn't sweep them */
+	if (bSweep && !Delta.IsNearlyZero())
+	{
+		CountSceneQuery(EMovementQueryType::Sweep);
+	}
+	
+	return Super::MoveUpdatedComponentImpl(Delta, NewRotation, bSweep, OutHit, Teleport);
 }
 
 bool URadicalMovementComponent::IsCrouching() const
@@ -442,6 +634,9 @@ void URadicalMovementComponent::OnTeleported()
 
 	bJustTeleported = true;
 
+	// Don't interpolate across the teleport
+	ResetFixedTimestepInterpolation();
+
 	UpdateFloorFromAdjustment();
 
 	UPrimitiveComponent* OldBase = GetMovementBase();
@@ -484,11 +679,12 @@ void URadicalMovementComponent::CalculateVelocity(float DeltaTime)
 		{
 			RMC_FLog(Error, "CalcualteVel not bound and MovementData is null. No method of calculating velocity")
 		}
-		else
+		else if (!ConsumeBatchedVelocity(DeltaTime))
 		{
 			MovementData->CalculateVelocity(this, DeltaTime);
 		}
 	}
+	BatchedVelocity.bValid = false;
 }
 
 void URadicalMovementComponent::UpdateRotation(float DeltaTime)
@@ -681,17 +877,24 @@ bool URadicalMovementComponent::CanMove() const
 
 float URadicalMovementComponent::GetSimulationTimeStep(float RemainingTime, uint32 Iterations) const
 {
-	if (RemainingTime > MaxSimulationTimeStep)
+	const float MaxTimeStep = GetMaxSimulationTimeStep();
+	if (RemainingTime > MaxTimeStep)
 	{
-		if (Iterations < MaxSimulationIterations)
+		if (static_cast<int32>(Iterations) < GetMaxSimulationIterations())
 		{
-			RemainingTime = FMath::Min(MaxSimulationTimeStep, RemainingTime * 0.5f);
+			RemainingTime = FMath::Min(MaxTimeStep, RemainingTime * 0.5f);
 		}
 	}
 
 	return FMath::Max(MIN_TICK_TIME, RemainingTime);
 }
 
+float URadicalMovementComponent::GetFirstSimulationTimeStep(float DeltaTime) const
+{
+	const bool bFixedTimestep = bUseFixedTimestep && FixedTimestep > 0.f;
+	return GetSimulationTimeStep(bFixedTimestep ? FixedTimestep : DeltaTime, 1);
+}
+
 
 void URadicalMovementComponent::PerformMovement(float DeltaTime)
 {
@@ -811,6 +1014,137 @@ void URadicalMovementComponent::PerformMovement(float DeltaTime)
 	PostMovementUpdate(DeltaTime);
 }
 
+float URadicalMovementComponent::SimulateMovement(float DeltaTime)
+{
+	if (!bUseFixedTimestep || FixedTimestep <= 0.f)
+	{
+		// Fixed steps were turned off at runtime, drop the offset of the last interpolation
+		if (bHasSimulatedFixedStep)
+		{
+			ResetFixedTimestepInterpolation();
+			UpdateFixedTimestepInterpolation();
+		}
+		
+		PerformMovement(DeltaTime);
+		return DeltaTime;
+	}
+
+	FixedTimestepAccumulator += DeltaTime;
+
+	int32 Steps = 0;
+	while (FixedTimestepAccumulator >= FixedTimestep && Steps < MaxFixedStepsPerFrame)
+	{
+		PreviousSimulatedLocation = UpdatedComponent->GetComponentLocation();
+		PreviousSimulatedRotation = UpdatedComponent->GetComponentQuat();
+
+		PerformMovement(FixedTimestep);
+		FixedTimestepAccumulator -= FixedTimestep;
+		bHasSimulatedFixedStep = true;
+		Steps++;
+	}
+	INC_DWORD_STAT_BY(STAT_FixedSteps, Steps)
+
+	/* Drop what we couldn't catch up on rather than carrying it into the next frames */
+	if (FixedTimestepAccumulator >= FixedTimestep)
+	{
+		const int32 DroppedSteps = FMath::FloorToInt(FixedTimestepAccumulator / FixedTimestep);
+		INC_DWORD_STAT_BY(STAT_FixedStepsDropped, DroppedSteps)
+		RMC_FLog(Verbose, "Dropping %d fixed steps, exceeded MaxFixedStepsPerFrame", DroppedSteps)
+		FixedTimestepAccumulator -= DroppedSteps * FixedTimestep;
+	}
+
+	UpdateFixedTimestepInterpolation();
+
+	return Steps * FixedTimestep;
+}
+
+void URadicalMovementComponent::UpdateFixedTimestepInterpolation()
+{
+	// Nothing to interpolate from until a step ran since the previous state was seeded
+	const bool bInterpolate = bUseFixedTimestep && bInterpolateFixedTimestep && FixedTimestep > 0.f && bHasSimulatedFixedStep;
+	if (bInterpolate)
+	{
+		/* Mesh goes where it would be between the last two steps, which is behind the capsule */
+		const float Alpha = FMath::Clamp(FixedTimestepAccumulator / FixedTimestep, 0.f, 1.f);
+		const FVector CurrentLocation = UpdatedComponent->GetComponentLocation();
+		const FQuat CurrentRotation = UpdatedComponent->GetComponentQuat();
+
+		FixedTimestepVisualOffset = (PreviousSimulatedLocation - CurrentLocation) * (1.f - Alpha);
+		FixedTimestepVisualRotation = FQuat::Slerp(PreviousSimulatedRotation, CurrentRotation, Alpha) * CurrentRotation.Inverse();
+	}
+	else
+	{
+		FixedTimestepVisualOffset = FVector::ZeroVector;
+		FixedTimestepVisualRotation = FQuat::Identity;
+	}
+
+	ApplyMeshVisualOffset();
+}
+
+void URadicalMovementComponent::ResetFixedTimestepInterpolation()
+{
+	bHasSimulatedFixedStep = false;
+	if (!UpdatedComponent) return;
+	
+	PreviousSimulatedLocation = UpdatedComponent->GetComponentLocation();
+	PreviousSimulatedRotation = UpdatedComponent->GetComponentQuat();
+}
+
+bool URadicalMovementComponent::GatherBatchedVelocity(float DeltaTime)
+{
+	BatchedVelocity.bValid = false;
+
+	// Anything taking CalculateVelocity off of the movement data, or skipping it, is left to the update
+	const bool bVelocityBound = VelocityBindings.PriorityBinding.IsBound() || VelocityBindings.SecondaryBinding.IsBound();
+	if (!MovementData || !MovementData->CanCalculateVelocitiesInBatch() || bVelocityBound || bHasRequestedVelocity) return false;
+	if (PhysicsState == STATE_None || HasRootMotionSources() || HasAnimRootMotion() || !GetPhysicsVolume()) return false;
+
+	// Time step & velocity of the first iteration of the first update, mirrors what the movement ticks do ahead of CalculateVelocity
+	const float UpdateTime = (bUseFixedTimestep && FixedTimestep > 0.f) ? FixedTimestep : DeltaTime;
+	if (UpdateTime < MIN_TICK_TIME || !PendingLaunchVelocity.IsZero()) return false;
+
+	// Pending forces & impulses (e.g pawn repulsion) are applied ahead of CalculateVelocity, unless they'd lift the character off the ground
+	const float PendingVertImpulse = PendingImpulseToApply | GetUpOrientation(MODE_Gravity);
+	const float PendingVertForce = PendingForceToApply | GetUpOrientation(MODE_Gravity);
+	if ((PendingVertImpulse != 0.f || PendingVertForce != 0.f) && IsMovingOnGround()
+		&& PendingVertImpulse + (PendingVertForce * UpdateTime) + (GetGravityZ() * UpdateTime) > UE_SMALL_NUMBER) return false;
+	
+	const FVector ForcedVelocity = Velocity + (PendingImpulseToApply + (PendingForceToApply * UpdateTime));
+	
+	BatchedVelocity.DeltaTime = GetFirstSimulationTimeStep(DeltaTime);
+	BatchedVelocity.Velocity = PhysicsState == STATE_Grounded ? GetHorizontalGroundVelocity(ForcedVelocity) : ForcedVelocity;
+	BatchedVelocity.Acceleration = MovementData->ComputeInputAcceleration(this);
+	BatchedVelocity.Gravity = GetGravity();
+	BatchedVelocity.GravityDir = GetGravityDir();
+	BatchedVelocity.TerminalVelocity = GetPhysicsVolume()->TerminalVelocity;
+	BatchedVelocity.MovementState = PhysicsState;
+	BatchedVelocity.Result = BatchedVelocity.Velocity;
+	BatchedVelocity.bValid = true;
+	BatchedVelocity.bUsed = false;
+	
+	return true;
+}
+
+bool URadicalMovementComponent::ConsumeBatchedVelocity(float DeltaTime)
+{
+	if (!BatchedVelocity.bValid) return false;
+	BatchedVelocity.bValid = false;
+
+	const bool bSameInputs = DeltaTime == BatchedVelocity.DeltaTime && PhysicsState == BatchedVelocity.MovementState && Velocity == BatchedVelocity.Velocity
+							&& InputAcceleration == BatchedVelocity.Acceleration && GetGravity() == BatchedVelocity.Gravity
+							&& GetPhysicsVolume() && GetPhysicsVolume()->TerminalVelocity == BatchedVelocity.TerminalVelocity;
+	if (!bSameInputs)
+	{
+		INC_DWORD_STAT(STAT_BatchedVelocitiesRejected)
+		return false;
+	}
+
+	INC_DWORD_STAT(STAT_BatchedVelocitiesUsed)
+	Velocity = BatchedVelocity.Result;
+	BatchedVelocity.bUsed = true;
+	return true;
+}
+
 bool URadicalMovementComponent::PreMovementUpdate(float DeltaTime)
 {
 	SCOPE_CYCLE_COUNTER(STAT_PreMovementUpdate)
@@ -873,7 +1207,7 @@ bool URadicalMovementComponent::PreMovementUpdate(float DeltaTime)
 
 void URadicalMovementComponent::StartMovementTick(float DeltaTime, uint32 Iterations)
 {
-	if ((DeltaTime < MIN_TICK_TIME) || (Iterations >= MaxSimulationIterations))
+	if ((DeltaTime < MIN_TICK_TIME) || (static_cast<int32>(Iterations) >= GetMaxSimulationIterations()))
 	{
 		return;
 	}
@@ -918,7 +1252,7 @@ void URadicalMovementComponent::GroundMovementTick(float DeltaTime, uint32 Itera
 	bool bTriedLedgeMove = false;
 	float RemainingTime = DeltaTime;
 	
-	while ((RemainingTime >= MIN_TICK_TIME) && (Iterations < MaxSimulationIterations))
+	while ((RemainingTime >= MIN_TICK_TIME) && (static_cast<int32>(Iterations) < GetMaxSimulationIterations()))
 	{
 		/* Setup current move iteration */
 		Iterations++;
@@ -1121,7 +1455,7 @@ void URadicalMovementComponent::AirMovementTick(float DeltaTime, uint32 Iteratio
 	// NOTE: Not much way to get the ShouldLimitAirControl equivalent here :/
 
 	const FVector Orientation = GetUpOrientation(MODE_Gravity);
-	while ((RemainingTime >= MIN_TICK_TIME) && (Iterations < MaxSimulationIterations))
+	while ((RemainingTime >= MIN_TICK_TIME) && (static_cast<int32>(Iterations) < GetMaxSimulationIterations()))
 	{
 		/* Setup current move iteration */
 		Iterations++;
@@ -1305,7 +1639,7 @@ void URadicalMovementComponent::GeneralMovementTick(float DeltaTime, uint32 Iter
 	bJustTeleported = false;
 	float RemainingTime = DeltaTime;
 	
-	while ((RemainingTime >= MIN_TICK_TIME) && (Iterations < MaxSimulationIterations))
+	while ((RemainingTime >= MIN_TICK_TIME) && (static_cast<int32>(Iterations) < GetMaxSimulationIterations()))
 	{
 		/* Setup current move iteration */
 		Iterations++;
@@ -1795,16 +2129,23 @@ void URadicalMovementComponent::ComputeFloorDist(const FVector& CapsuleLocation,
 	{
 		/* Use a shorter height to avoid weeps giving weird results if we start on a surface. Allows us to also adjust out of penetrations */
 		// Basically, sweeping with a shrunk capsule will let us "catch' penetrations, in this case within the last 10% of our capsule size
-		const float ShrinkScale = 0.9f;
+		const float ShrinkScale = FLOOR_SWEEP_SHRINK_SCALE;
 		const float ShrinkScaleOverlap = 0.1f;
 		float ShrinkHeight = (PawnHalfHeight - PawnRadius) * (1.f - ShrinkScale);
 		float TraceDist = SweepDistance + ShrinkHeight;
 		FCollisionShape CapsuleShape = FCollisionShape::MakeCapsule(SweepRadius, PawnHalfHeight - ShrinkHeight);
 
 		/* ~~~~~~~~~~~~~~~~~~~ */
-		/* Perform Shape Trace */
+		/* Perform Shape Trace, unless the async probe issued last update already covers it */
 		FHitResult Hit(1.f);
-		bBlockingHit = FloorSweepTest(Hit, CapsuleLocation, CapsuleLocation - GetUpOrientation(MODE_PawnUp) * TraceDist, CollisionChannel, CapsuleShape, QueryParams, ResponseParam);
+		if (const_cast<URadicalMovementComponent*>(this)->ConsumeAsyncFloorProbe(CapsuleLocation, SweepRadius, TraceDist, Hit))
+		{
+			bBlockingHit = Hit.bBlockingHit;
+		}
+		else
+		{
+			bBlockingHit = FloorSweepTest(Hit, CapsuleLocation, CapsuleLocation - GetUpOrientation(MODE_PawnUp) * TraceDist, CollisionChannel, CapsuleShape, QueryParams, ResponseParam);
+		}
 		
 		if (bBlockingHit)
 		{
@@ -1862,6 +2203,7 @@ void URadicalMovementComponent::ComputeFloorDist(const FVector& CapsuleLocation,
 
 		FHitResult Hit(1.f);
 		bBlockingHit = GetWorld()->LineTraceSingleByChannel(Hit, LineTraceStart, LineTraceStart + Down, CollisionChannel, QueryParams, ResponseParam);
+		CountSceneQuery(EMovementQueryType::LineTrace);
 		LOG_HIT(Hit, 2.f);
 		
 		if (bBlockingHit)
@@ -1893,6 +2235,7 @@ void URadicalMovementComponent::FindFloor(const FVector& CapsuleLocation, FGroun
 	bool bCanUseCachedLocation, const FHitResult* DownwardSweepResult) const
 {
 	SCOPE_CYCLE_COUNTER(STAT_FindFloor)
+	RMC_QUERY_SITE(Floor)
 	
 	/* If collision is not enabled, or bSolveGrounding is not set, we don't care */
 	if (!UpdatedComponent->IsQueryCollisionEnabled())
@@ -1906,14 +2249,16 @@ void URadicalMovementComponent::FindFloor(const FVector& CapsuleLocation, FGroun
 		DEBUG_PRINT_MSG(2, "Find Floor Downward Sweep Hit")
 		LOG_HIT((*DownwardSweepResult), 2);
 	}
+	else if (!bForceNextFloorCheck && !bJustTeleported && GetCachedFloor(CapsuleLocation, OutFloorResult))
+	{
+		/* Nothing the last floor depended on changed */
+		return;
+	}
 	
 	const float CapsuleRadius = CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius();
 
-	/* Increase height check slightly if currently groudned to prevent ground snapping height from later invalidating the floor result */
-	const float HeightCheckAdjust = (IsMovingOnGround() ? MAX_FLOOR_DIST + UE_KINDA_SMALL_NUMBER : -MAX_FLOOR_DIST);
-
 	/* Setup sweep distances */
-	float FloorSweepTraceDist = FMath::Max(MAX_FLOOR_DIST, FMath::Max(ExtraFloorProbingDistance, MaxStepHeight) + HeightCheckAdjust);
+	float FloorSweepTraceDist = GetFloorProbeDistance();
 	float FloorLineTraceDist = FloorSweepTraceDist;
 	bool bNeedToValidateFloor =  true;
 
@@ -1963,7 +2308,7 @@ void URadicalMovementComponent::FindFloor(const FVector& CapsuleLocation, FGroun
 	{
 		if (ShouldComputePerchResult(OutFloorResult.HitResult))
 		{
-			float MaxPerchFloorDist = FMath::Max(MAX_FLOOR_DIST, FMath::Max(ExtraFloorProbingDistance, MaxStepHeight) + HeightCheckAdjust);
+			float MaxPerchFloorDist = GetFloorProbeDistance();
 			if (IsMovingOnGround())
 			{
 				MaxPerchFloorDist += FMath::Max(0.f, PerchAdditionalHeight);
@@ -1993,6 +2338,9 @@ void URadicalMovementComponent::FindFloor(const FVector& CapsuleLocation, FGroun
 			}
 		}
 	}
+
+	URadicalMovementComponent* MutableThis = const_cast<URadicalMovementComponent*>(this);
+	MutableThis->CacheFloor(CapsuleLocation, OutFloorResult);
 }
 
 // DONE
@@ -2005,6 +2353,7 @@ bool URadicalMovementComponent::FloorSweepTest(FHitResult& OutHit, const FVector
 	if (!bUseFlatBaseForFloorChecks)
 	{
 		bBlockingHit = GetWorld()->SweepSingleByChannel(OutHit, Start, End, UpdatedComponent->GetComponentQuat(), TraceChannel, CollisionShape, Params, ResponseParams);
+		CountSceneQuery(EMovementQueryType::Sweep);
 	} // Don't use flat base for sweep
 	else
 	{
@@ -2015,12 +2364,14 @@ bool URadicalMovementComponent::FloorSweepTest(FHitResult& OutHit, const FVector
 
 		/* First test with a box rotates so the corners are along the major axes (ie rotated 45 Degrees) */
 		bBlockingHit = GetWorld()->SweepSingleByChannel(OutHit, Start, End, FQuat(-1.f * GetUpOrientation(MODE_PawnUp), UE_PI * 0.25f), TraceChannel, BoxShape, Params, ResponseParams);
+		CountSceneQuery(EMovementQueryType::Sweep);
 		
 		/* If no hit, check again but without a rotated capsule */
 		if (!bBlockingHit)
 		{
 			OutHit.Reset(1.f, false);
 			bBlockingHit = GetWorld()->SweepSingleByChannel(OutHit, Start, End, UpdatedComponent->GetComponentQuat(), TraceChannel, BoxShape, Params, ResponseParams);
+			CountSceneQuery(EMovementQueryType::Sweep);
 		}
 	} // Use flat base for sweep
 
@@ -2028,6 +2379,212 @@ bool URadicalMovementComponent::FloorSweepTest(FHitResult& OutHit, const FVector
 	return bBlockingHit;
 }
 
+float URadicalMovementComponent::GetFloorProbeDistance() const
+{
+	/* Increase height check slightly if currently groudned to prevent ground snapping height from later invalidating the floor result */
+	const float HeightCheckAdjust = (IsMovingOnGround() ? MAX_FLOOR_DIST + UE_KINDA_SMALL_NUMBER : -MAX_FLOOR_DIST);
+	return FMath::Max(MAX_FLOOR_DIST, FMath::Max(ExtraFloorProbingDistance, MaxStepHeight) + HeightCheckAdjust);
+}
+
+bool URadicalMovementComponent::GetCachedFloor(const FVector& CapsuleLocation, FGroundingStatus& OutFloorResult) const
+{
+	if (!bUseFloorCache || RMCCVars::FloorCache <= 0) return false;
+
+	const UPrimitiveComponent* FloorComponent = FloorCache.FloorComponent.Get();
+	if (!FloorCache.bValid || !FloorComponent)
+	{
+		INC_DWORD_STAT(STAT_FloorCacheMisses)
+		return false;
+	}
+
+	float PawnRadius, PawnHalfHeight;
+	CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(PawnRadius, PawnHalfHeight);
+	const FVector Up = GetUpOrientation(MODE_PawnUp);
+	const FVector Delta = CapsuleLocation - FloorCache.CapsuleLocation;
+
+	const bool bCapsuleChanged = Delta.SizeSquared() > FMath::Square(FloorCacheDistanceThreshold) || PawnRadius != FloorCache.CapsuleRadius || PawnHalfHeight != FloorCache.CapsuleHalfHeight
+		|| !Up.Equals(FloorCache.UpDirection) || !GravityDir.Equals(FloorCache.GravityDirection) || GetFloorProbeDistance() != FloorCache.ProbeDistance;
+	const bool bFloorChanged = !FloorComponent->GetComponentTransform().Equals(FloorCache.FloorTransform) || !FloorComponent->IsQueryCollisionEnabled()
+		|| FloorComponent->GetCollisionResponseToChannel(UpdatedComponent->GetCollisionObjectType()) != ECR_Block;
+
+	/* Only the cached primitive is watched, anything else showing up under the pawn is caught by expiring the cache or the overlaps changing */
+	const bool bExpired = GetWorld()->GetTimeSeconds() - FloorCache.CacheTime > FloorCacheMaxAge || GetOverlapsHash() != FloorCache.OverlapsHash;
+
+	if (bCapsuleChanged || bFloorChanged || bExpired)
+	{
+		INC_DWORD_STAT(STAT_FloorCacheMisses)
+		return false;
+	}
+
+	/* Account for how much we moved vertically since it was cached, the contact stays on the floor so it only follows the lateral movement */
+	const float HeightDelta = Delta | Up;
+	OutFloorResult = FloorCache.Floor;
+	OutFloorResult.FloorDist += HeightDelta;
+	if (OutFloorResult.bLineTrace)
+	{
+		OutFloorResult.LineDist += HeightDelta;
+	}
+	OutFloorResult.HitResult.Location += Delta - Up * HeightDelta;
+	OutFloorResult.HitResult.TraceStart += Delta;
+	OutFloorResult.HitResult.TraceEnd += Delta;
+
+	INC_DWORD_STAT(STAT_FloorCacheHits)
+	return true;
+}
+
+void URadicalMovementComponent::CacheFloor(const FVector& CapsuleLocation, const FGroundingStatus& FloorResult)
+{
+	FloorCache.Invalidate();
+
+	/* Only floors we have a primitive to watch for changes can be cached */
+	UPrimitiveComponent* FloorComponent = FloorResult.HitResult.GetComponent();
+	if (!bUseFloorCache || !FloorResult.bBlockingHit || !FloorComponent) return;
+
+	CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(FloorCache.CapsuleRadius, FloorCache.CapsuleHalfHeight);
+	FloorCache.Floor = FloorResult;
+	FloorCache.CapsuleLocation = CapsuleLocation;
+	FloorCache.UpDirection = GetUpOrientation(MODE_PawnUp);
+	FloorCache.GravityDirection = GravityDir;
+	FloorCache.FloorTransform = FloorComponent->GetComponentTransform();
+	FloorCache.FloorComponent = FloorComponent;
+	FloorCache.ProbeDistance = GetFloorProbeDistance();
+	FloorCache.CacheTime = GetWorld()->GetTimeSeconds();
+	FloorCache.OverlapsHash = GetOverlapsHash();
+	FloorCache.bValid = true;
+}
+
+uint32 URadicalMovementComponent::GetOverlapsHash() const
+{
+	uint32 Hash = 0;
+	for (const FOverlapInfo& Overlap : UpdatedPrimitive->GetOverlapInfos())
+	{
+		Hash = HashCombineFast(Hash, GetTypeHash(Overlap.OverlapInfo.Component));
+	}
+	return Hash;
+}
+
+void URadicalMovementComponent::IssueAsyncFloorProbe(float DeltaTime)
+{
+	AsyncFloorProbe.Reset();
+
+	if (!bUseAsyncFloorProbes || RMCCVars::AsyncFloorProbes <= 0 || bUseFlatBaseForFloorChecks) return;
+	if (!CharacterOwner || !IsMovingOnGround() || !UpdatedComponent->IsQueryCollisionEnabled()) return;
+
+	float PawnRadius, PawnHalfHeight;
+	CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(PawnRadius, PawnHalfHeight);
+
+	/* Mirror the first sweep of ComputeFloorDist, from where the first step of the next update would take us if we kept moving at the same velocity */
+	const float ShrinkHeight = (PawnHalfHeight - PawnRadius) * (1.f - FLOOR_SWEEP_SHRINK_SCALE);
+	const FVector Up = GetUpOrientation(MODE_PawnUp);
+
+	/* The next step can be more than a frame away when the movement LOD skips updates or the fixed timestep hasn't accumulated a step yet */
+	const FMovementLODTier* LODTier = GetMovementLODTier();
+	float TimeToNextStep = GetWorld()->GetDeltaSeconds();
+	if (LODTier) TimeToNextStep = FMath::Max(TimeToNextStep, LODTier->UpdateInterval);
+	if (bUseFixedTimestep && FixedTimestep > 0.f) TimeToNextStep = FMath::Max(TimeToNextStep, FixedTimestep - FixedTimestepAccumulator);
+
+	AsyncFloorProbe.PredictedLocation = UpdatedComponent->GetComponentLocation() + Velocity * GetFirstSimulationTimeStep(DeltaTime);
+	AsyncFloorProbe.UpDirection = Up;
+	AsyncFloorProbe.SweepRadius = PawnRadius;
+	AsyncFloorProbe.TraceDist = GetFloorProbeDistance() + ShrinkHeight;
+	AsyncFloorProbe.ExpiryTime = GetWorld()->GetTimeSeconds() + TimeToNextStep + GetWorld()->GetDeltaSeconds();
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AsyncFloorProbe), false, GetPawnOwner());
+	FCollisionResponseParams ResponseParam;
+	InitCollisionParams(QueryParams, ResponseParam);
+
+	const FVector Start = AsyncFloorProbe.PredictedLocation;
+	const FVector End = Start - Up * AsyncFloorProbe.TraceDist;
+	const FCollisionShape CapsuleShape = FCollisionShape::MakeCapsule(PawnRadius, PawnHalfHeight - ShrinkHeight);
+	AsyncFloorProbe.Handle = GetWorld()->AsyncSweepByChannel(EAsyncTraceType::Single, Start, End, UpdatedComponent->GetComponentQuat(),
+		UpdatedComponent->GetCollisionObjectType(), CapsuleShape, QueryParams, ResponseParam, &AsyncFloorProbeDelegate);
+
+	RMC_QUERY_SITE(Floor)
+	CountSceneQuery(EMovementQueryType::Sweep);
+}
+
+void URadicalMovementComponent::OnAsyncFloorProbeCompleted(const FTraceHandle& Handle, FTraceDatum& Data)
+{
+	/* Stale probe, a newer one was issued since */
+	if (Handle != AsyncFloorProbe.Handle) return;
+
+	AsyncFloorProbe.Hit = FHitResult(1.f);
+	for (const FHitResult& Hit : Data.OutHits)
+	{
+		if (Hit.bBlockingHit)
+		{
+			AsyncFloorProbe.Hit = Hit;
+			break;
+		}
+	}
+	AsyncFloorProbe.bHasResult = true;
+}
+
+bool URadicalMovementComponent::ConsumeAsyncFloorProbe(const FVector& CapsuleLocation, float SweepRadius, float TraceDist, FHitResult& OutHit)
+{
+	if (!AsyncFloorProbe.bHasResult) return false;
+
+	/* Only valid for the update following the one it was issued from */
+	if (GetWorld()->GetTimeSeconds() > AsyncFloorProbe.ExpiryTime)
+	{
+		AsyncFloorProbe.Reset();
+		return false;
+	}
+
+	/* Has to be the sweep we'd be doing, other sweeps (e.g perching) leave it for the floor check it was issued for */
+	const FVector Up = GetUpOrientation(MODE_PawnUp);
+	if (!FMath::IsNearlyEqual(SweepRadius, AsyncFloorProbe.SweepRadius) || !FMath::IsNearlyEqual(TraceDist, AsyncFloorProbe.TraceDist)
+		|| (Up | AsyncFloorProbe.UpDirection) < THRESH_NORMALS_ARE_PARALLEL)
+	{
+		return false;
+	}
+
+	/* Past this point the probe is either used or rejected, never looked at again */
+	const FVector Offset = CapsuleLocation - AsyncFloorProbe.PredictedLocation;
+	const FHitResult ProbeHit = AsyncFloorProbe.Hit;
+	AsyncFloorProbe.Reset();
+	
+	if (Offset.SizeSquared() > FMath::Square(AsyncFloorProbeTolerance))
+	{
+		INC_DWORD_STAT(STAT_AsyncFloorProbesRejected)
+		return false;
+	}
+
+	/* Bring the result over to the actual location, the vertical offset changes the distance to the hit while the contact stays on the floor */
+	const float VerticalOffset = Offset | Up;
+	OutHit = ProbeHit;
+	if (OutHit.bBlockingHit)
+	{
+		if (OutHit.bStartPenetrating)
+		{
+			INC_DWORD_STAT(STAT_AsyncFloorProbesRejected)
+			return false;
+		}
+
+		const float HitDistance = OutHit.Time * TraceDist + VerticalOffset;
+		if (HitDistance < 0.f || HitDistance > TraceDist)
+		{
+			INC_DWORD_STAT(STAT_AsyncFloorProbesRejected)
+			return false;
+		}
+
+		OutHit.Time = HitDistance / TraceDist;
+		OutHit.Distance = HitDistance;
+		OutHit.Location += Offset - Up * VerticalOffset;
+	}
+	else if (VerticalOffset < 0.f)
+	{
+		/* Missed, but the probe stopped short of where our own sweep would end */
+		INC_DWORD_STAT(STAT_AsyncFloorProbesRejected)
+		return false;
+	}
+	OutHit.TraceStart += Offset;
+	OutHit.TraceEnd += Offset;
+
+	INC_DWORD_STAT(STAT_AsyncFloorProbesUsed)
+	return true;
+}
+
 // TODO
 bool URadicalMovementComponent::IsValidLandingSpot(const FVector& CapsuleLocation, const FHitResult& Hit) const
 {
@@ -2137,9 +2694,7 @@ void URadicalMovementComponent::MaintainHorizontalGroundVelocity()
 	*/
 	
 	// Old Method, worked pretty well, split the projected into components so we don't change dir of our vel on the ground plane
-	const float VelMag = Velocity.Size();
-	FVector ProjectedVelocity = FVector::VectorPlaneProject(Velocity, CurrentFloor.HitResult.ImpactNormal).GetSafeNormal() * VelMag;
-	Velocity = FVector::VectorPlaneProject(Velocity, GravityDir).GetSafeNormal() * FVector::VectorPlaneProject(ProjectedVelocity, GravityDir).Size() + ProjectedVelocity.ProjectOnToNormal(GravityDir);
+	Velocity = GetHorizontalGroundVelocity(Velocity);
 
 	// CONE SQUEEZE ROTATION V (THERE IS POTENTIAL HERE GANG) //
 	// First cone opening angle defines the prev floor normal we were moving on
@@ -2165,6 +2720,13 @@ void URadicalMovementComponent::MaintainHorizontalGroundVelocity()
 	Velocity = (GroundQuat * Velocity.GetSafeNormal()) * Velocity.Size();*/
 }
 
+FVector URadicalMovementComponent::GetHorizontalGroundVelocity(const FVector& InVelocity) const
+{
+	const float VelMag = InVelocity.Size();
+	const FVector ProjectedVelocity = FVector::VectorPlaneProject(InVelocity, CurrentFloor.HitResult.ImpactNormal).GetSafeNormal() * VelMag;
+	return FVector::VectorPlaneProject(InVelocity, GravityDir).GetSafeNormal() * FVector::VectorPlaneProject(ProjectedVelocity, GravityDir).Size() + ProjectedVelocity.ProjectOnToNormal(GravityDir);
+}
+
 void URadicalMovementComponent::RecalculateVelocityToReflectMove(const FVector& OldLocation, const float DeltaTime)
 {
 	const float PreVelSize = FMath::Abs(Velocity.Size());
@@ -2210,6 +2772,7 @@ void URadicalMovementComponent::RecalculateVelocityToReflectMove(const FVector&
 bool URadicalMovementComponent::StepUp(const FVector& Orientation, const FHitResult& StepHit, const FVector& Delta, FStepDownFloorResult* OutStepDownResult)
 {
 	SCOPE_CYCLE_COUNTER(STAT_StepUp)
+	RMC_QUERY_SITE(StepUp)
 
 	/* Ensure we can step up */
 	if (!CanStepUp(StepHit) || MaxStepHeight <= 0.f) return false;
@@ -2460,6 +3023,7 @@ bool URadicalMovementComponent::ShouldCatchAir(const FGroundingStatus& OldFloor,
 {
 	// Check if we even need to look at this setting
 	if (!bLedgeAndDenivelationHandling) return false;
+	if (const FMovementLODTier* LODTier = GetMovementLODTier(); LODTier && !LODTier->bPerchAndLedgeChecks) return false;
 	
 	// There are four possible permutations to consider: (Velocity to the right in below diagrams)
 	// 1.) [ _/ ] ALWAYS FALSE (Negative Angle Change, Positive Height Change)
@@ -2501,6 +3065,12 @@ bool URadicalMovementComponent::ShouldComputePerchResult(const FHitResult& InHit
 	{
 		return false;
 	}
+
+	/* Skipped by the movement LOD */
+	if (const FMovementLODTier* LODTier = GetMovementLODTier(); LODTier && !LODTier->bPerchAndLedgeChecks)
+	{
+		return false;
+	}
 	
 	/* Don't attempt perch if the edge radius is very small */
 	if (GetPerchRadiusThreshold() <= SWEEP_EDGE_REJECT_DISTANCE)
@@ -2526,6 +3096,8 @@ bool URadicalMovementComponent::ShouldComputePerchResult(const FHitResult& InHit
 bool URadicalMovementComponent::ComputePerchResult(const float TestRadius, const FHitResult& InHit,
 	const float InMaxFloorDist, FGroundingStatus& OutPerchFloorResult) const
 {
+	RMC_QUERY_SITE(Perch)
+	
 	if (InMaxFloorDist <= 0.f)
 	{
 		return false;
@@ -2562,6 +3134,8 @@ bool URadicalMovementComponent::ComputePerchResult(const float TestRadius, const
 
 bool URadicalMovementComponent::CheckLedgeDirection(const FVector& OldLocation, const FVector& SideStep)
 {
+	RMC_QUERY_SITE(LedgeCheck)
+	
 	const FVector SideDest = OldLocation + SideStep;
 	FCollisionQueryParams CapsuleParams(SCENE_QUERY_STAT(CheckLedgeDirection), false, PawnOwner);
 	FCollisionResponseParams ResponseParams;
@@ -2570,6 +3144,7 @@ bool URadicalMovementComponent::CheckLedgeDirection(const FVector& OldLocation,
 	const ECollisionChannel CollisionChannel = UpdatedComponent->GetCollisionObjectType();
 	FHitResult Result(1.f);
 	GetWorld()->SweepSingleByChannel(Result, OldLocation, SideDest, FQuat::Identity, CollisionChannel, CapsuleShape, CapsuleParams, ResponseParams);
+	CountSceneQuery(EMovementQueryType::Sweep);
 
 	LOG_HIT(Result, 2.f);
 	
@@ -2578,6 +3153,7 @@ bool URadicalMovementComponent::CheckLedgeDirection(const FVector& OldLocation,
 	    if (!Result.bBlockingHit)
 	    {
 			GetWorld()->SweepSingleByChannel(Result, SideDest, SideDest + GravityDir * (MaxStepHeight + LedgeCheckThreshold), FQuat::Identity, CollisionChannel, CapsuleShape, CapsuleParams, ResponseParams);
+			CountSceneQuery(EMovementQueryType::Sweep);
 	    }
 	    if ((Result.Time < 1.f) && IsFloorStable(Result))
 	    {
@@ -2641,6 +3217,8 @@ bool URadicalMovementComponent::CanCrouchInCurrentState() const
 
 void URadicalMovementComponent::Crouch()
 {
+	RMC_QUERY_SITE(Crouch)
+	
 	if (!IsValid(CharacterOwner))
 	{
 		return;
@@ -2678,6 +3256,7 @@ void URadicalMovementComponent::Crouch()
 			InitCollisionParams(CapsuleParams, ResponseParam);
 			const bool bEncroached = GetWorld()->OverlapBlockingTestByChannel(UpdatedComponent->GetComponentLocation() - GetUpOrientation(MODE_PawnUp) * ScaledHalfHeightAdjust, UpdatedComponent->GetComponentQuat(),
 				UpdatedComponent->GetCollisionObjectType(), GetCapsuleCollisionShape(SHRINK_None), CapsuleParams, ResponseParam);
+			CountSceneQuery(EMovementQueryType::Overlap);
 
 			// If encroached, cancel
 			if( bEncroached )
@@ -2710,6 +3289,8 @@ void URadicalMovementComponent::Crouch()
 
 void URadicalMovementComponent::UnCrouch()
 {
+	RMC_QUERY_SITE(Crouch)
+	
 	if (!IsValid(CharacterOwner))
 	{
 		return;
@@ -2754,6 +3335,7 @@ void URadicalMovementComponent::UnCrouch()
 		{
 			// Expand in place
 			bEncroached = MyWorld->OverlapBlockingTestByChannel(PawnLocation, UpdatedComponent->GetComponentQuat(), CollisionChannel, StandingCapsuleShape, CapsuleParams, ResponseParam);
+			CountSceneQuery(EMovementQueryType::Overlap);
 		
 			if (bEncroached)
 			{
@@ -2770,6 +3352,7 @@ void URadicalMovementComponent::UnCrouch()
 					FHitResult Hit(1.f);
 					const FCollisionShape ShortCapsuleShape = GetCapsuleCollisionShape(SHRINK_HeightCustom, ShrinkHalfHeight);
 					const bool bBlockingHit = MyWorld->SweepSingleByChannel(Hit, PawnLocation, PawnLocation + Down, UpdatedComponent->GetComponentQuat(), CollisionChannel, ShortCapsuleShape, CapsuleParams);
+					CountSceneQuery(EMovementQueryType::Sweep);
 					if (Hit.bStartPenetrating)
 					{
 						bEncroached = true;
@@ -2780,6 +3363,7 @@ void URadicalMovementComponent::UnCrouch()
 						const float DistanceToBase = (Hit.Time * TraceDist) + ShortCapsuleShape.Capsule.HalfHeight;
 						const FVector NewLoc = FVector::VectorPlaneProject(PawnLocation, GetUpOrientation(MODE_PawnUp)) + PawnLocation.ProjectOnTo(GetUpOrientation(MODE_PawnUp)) + GetUpOrientation(MODE_PawnUp) *(-DistanceToBase + StandingCapsuleShape.Capsule.HalfHeight + SweepInflation + MIN_FLOOR_DIST / 2.f);
 						bEncroached = MyWorld->OverlapBlockingTestByChannel(NewLoc, UpdatedComponent->GetComponentQuat(), CollisionChannel, StandingCapsuleShape, CapsuleParams, ResponseParam);
+						CountSceneQuery(EMovementQueryType::Overlap);
 						if (!bEncroached)
 						{
 							// Intentionally not using MoveUpdatedComponent, where a horizontal plane constraint would prevent the base of the capsule from staying at the same spot.
@@ -2794,6 +3378,7 @@ void URadicalMovementComponent::UnCrouch()
 			// Expand while keeping base location the same.
 			FVector StandingLocation = PawnLocation + GetUpOrientation(MODE_PawnUp) * (StandingCapsuleShape.GetCapsuleHalfHeight() - CurrentCrouchedHalfHeight);
 			bEncroached = MyWorld->OverlapBlockingTestByChannel(StandingLocation, UpdatedComponent->GetComponentQuat(), CollisionChannel, StandingCapsuleShape, CapsuleParams, ResponseParam);
+			CountSceneQuery(EMovementQueryType::Overlap);
 
 			if (bEncroached)
 			{
@@ -2805,6 +3390,7 @@ void URadicalMovementComponent::UnCrouch()
 					{
 						StandingLocation -= GetUpOrientation(MODE_PawnUp) * CurrentFloor.FloorDist - MinFloorDist;
 						bEncroached = MyWorld->OverlapBlockingTestByChannel(StandingLocation, UpdatedComponent->GetComponentQuat(), CollisionChannel, StandingCapsuleShape, CapsuleParams, ResponseParam);
+						CountSceneQuery(EMovementQueryType::Overlap);
 					}
 				}				
 			}
@@ -2933,6 +3519,7 @@ FVector URadicalMovementComponent::HandleSlopeBoosting(const FVector& SlideResul
 float URadicalMovementComponent::SlideAlongSurface(const FVector& Delta, float Time, const FVector& InNormal, FHitResult& Hit, bool bHandleImpact)
 {
 	SCOPE_CYCLE_COUNTER(STAT_SlideAlongSurface)
+	RMC_QUERY_SITE(SlideAlongSurface)
 	
 	if (!Hit.bBlockingHit) return 0.f;
 	
@@ -3413,11 +4000,29 @@ void URadicalMovementComponent::ApplyDownwardForce(float DeltaTime)
 	}
 }
 
+void URadicalMovementComponent::ApplyPawnRepulsion(float DeltaTime)
+{
+	if (RepulsionIndex == INDEX_NONE || PhysicsState == STATE_None)
+	{
+		return;
+	}
+
+	if (URadicalMovementSubsystem* MovementSubsystem = GetWorld()->GetSubsystem<URadicalMovementSubsystem>())
+	{
+		// Acceleration rather than force, crowds separate the same regardless of the mass of each pawn
+		PendingForceToApply += MovementSubsystem->GetPawnRepulsion(this);
+	}
+}
+
 void URadicalMovementComponent::ApplyRepulsionForce(float DeltaTime)
 {
 	if (UpdatedPrimitive && RepulsionForce > 0.f && PawnOwner != nullptr)
 	{
+		RMC_QUERY_SITE(Repulsion)
+		
+		/* Overlaps are maintained by the sweeps of the moves, they are counted as evaluated rather than queried */
 		const TArray<FOverlapInfo>& Overlaps = UpdatedPrimitive->GetOverlapInfos();
+		CountSceneQuery(EMovementQueryType::Overlap, Overlaps.Num());
 		if (Overlaps.Num() > 0)
 		{
 			FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(RMC_ApplyRepulsionForce));
@@ -3474,6 +4079,7 @@ void URadicalMovementComponent::ApplyRepulsionForce(float DeltaTime)
 				FVector EndTraceLocation = FVector::VectorPlaneProject(MyLocation, GetUpOrientation(MODE_Gravity)) + BodyLocation.ProjectOnToNormal(GetUpOrientation(MODE_Gravity));
 				FHitResult Hit;
 				bool bHasHit = UpdatedPrimitive->LineTraceComponent(Hit, BodyLocation, EndTraceLocation, QueryParams);
+				CountSceneQuery(EMovementQueryType::LineTrace);
 
 				FVector HitLoc = Hit.ImpactPoint;
 				bool bIsPenetrating = Hit.bStartPenetrating || Hit.PenetrationDepth > StopBodyDistance;
@@ -3558,14 +4164,14 @@ FVector URadicalMovementComponent::GetImpartedMovementBaseVelocity() const
 	UPrimitiveComponent* MovementBase = CharacterOwner->GetMovementBase();
 	if (MovementBaseUtility::IsDynamicBase(MovementBase))
 	{
-		FVector BaseVelocity = MovementBaseUtility::GetMovementBaseVelocity(MovementBase, CharacterOwner->GetBasedMovement().BoneName);
+		const FMovementBaseState BaseState = GetMovementBaseState();
+		FVector BaseVelocity = BaseState.LinearVelocity;
 
 		if (bImpartBaseAngularVelocity)
 		{
 			// NOTE: the below used to be MODE_FloorNormal but removed that mode since nothing else used it though I think using that metric makes more sense?
 			const FVector BasePointPosition = (UpdatedComponent->GetComponentLocation() - GetUpOrientation(MODE_Gravity) * CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleHalfHeight());
-			const FVector BaseTangentialVel = MovementBaseUtility::GetMovementBaseTangentialVelocity(MovementBase, CharacterOwner->GetBasedMovement().BoneName, BasePointPosition);
-			BaseVelocity += BaseTangentialVel;
+			BaseVelocity += BaseState.GetTangentialVelocity(BasePointPosition);
 		}
 		
 		if (bImpartBaseVelocityPlanar)
@@ -3582,6 +4188,25 @@ FVector URadicalMovementComponent::GetImpartedMovementBaseVelocity() const
 	return Result;
 }
 
+FMovementBaseState URadicalMovementComponent::GetMovementBaseState() const
+{
+	const UPrimitiveComponent* MovementBase = GetMovementBase();
+	const FName BoneName = CharacterOwner ? CharacterOwner->GetBasedMovement().BoneName : NAME_None;
+
+	URadicalMovementSubsystem* MovementSubsystem = MovementBase ? GetWorld()->GetSubsystem<URadicalMovementSubsystem>() : nullptr;
+	return MovementSubsystem ? MovementSubsystem->GetMovementBaseState(MovementBase, BoneName) : URadicalMovementSubsystem::ComputeMovementBaseState(MovementBase, BoneName);
+}
+
+FMovementBaseDelta URadicalMovementComponent::GetMovementBaseDelta() const
+{
+	const UPrimitiveComponent* MovementBase = GetMovementBase();
+	const FName BoneName = CharacterOwner ? CharacterOwner->GetBasedMovement().BoneName : NAME_None;
+
+	URadicalMovementSubsystem* MovementSubsystem = MovementBase ? GetWorld()->GetSubsystem<URadicalMovementSubsystem>() : nullptr;
+	return MovementSubsystem ? MovementSubsystem->GetMovementBaseDelta(MovementBase, BoneName, OldBaseLocation, OldBaseQuat)
+		: URadicalMovementSubsystem::ComputeMovementBaseDelta(URadicalMovementSubsystem::ComputeMovementBaseState(MovementBase, BoneName), OldBaseLocation, OldBaseQuat);
+}
+
 void URadicalMovementComponent::DecayFormerBaseVelocity(float DeltaTime)
 {
 	if (!bMoveWithBase) return;
@@ -3616,7 +4241,7 @@ void URadicalMovementComponent::TryUpdateBasedMovement(float DeltaTime)
 			if (PostPhysicsTickFunction.IsTickFunctionEnabled())
 			{
 				PostPhysicsTickFunction.SetTickFunctionEnable(false);
-				MovementBaseUtility::AddTickDependency(PrimaryComponentTick, MovementBase);
+				AddMovementBaseTickDependency(MovementBase);
 			}
 		}
 		else
@@ -3627,7 +4252,7 @@ void URadicalMovementComponent::TryUpdateBasedMovement(float DeltaTime)
 			if (!PostPhysicsTickFunction.IsTickFunctionEnabled())
 			{
 				PostPhysicsTickFunction.SetTickFunctionEnable(true);
-				MovementBaseUtility::RemoveTickDependency(PrimaryComponentTick, MovementBase);
+				RemoveMovementBaseTickDependency(MovementBase);
 			}
 		}
 	}
@@ -3660,31 +4285,22 @@ void URadicalMovementComponent::UpdateBasedMovement(float DeltaTime)
 	// Ignore collision with bases during these movement
 	TGuardValue<EMoveComponentFlags> ScopedFlagRestore(MoveComponentFlags, MoveComponentFlags | MOVECOMP_IgnoreBases);
 
-	FQuat DeltaQuat = FQuat::Identity;
 	FVector DeltaPosition = FVector::ZeroVector;
 
-	FQuat NewBaseQuat;
-	FVector NewBaseLocation;
-	if (!MovementBaseUtility::GetMovementBaseTransform(MovementBase, CharacterOwner->GetBasedMovement().BoneName, NewBaseLocation, NewBaseQuat))
+	// Move of the base since the last update, pawns that saved the same base transform share it
+	const FMovementBaseDelta BaseDelta = GetMovementBaseDelta();
+	if (!BaseDelta.bHasTransform)
 	{
 		return;
 	}
-
-	// Find change in rotation
-	const bool bRotationChanged = !OldBaseQuat.Equals(NewBaseQuat, 1e-8f);
-	if (bRotationChanged)
-	{
-		DeltaQuat = NewBaseQuat * OldBaseQuat.Inverse();
-	}
+	const bool bRotationChanged = BaseDelta.bRotationChanged;
+	const FQuat DeltaQuat = BaseDelta.DeltaRotation;
 
 	// Only if base moved
-	if (bRotationChanged || (OldBaseLocation != NewBaseLocation))
+	if (BaseDelta.bMoved)
 	{
-		// Calculate new transform matrix of base actor (ignoring scale)
-		const FQuatRotationTranslationMatrix OldLocalToWorld(OldBaseQuat, OldBaseLocation);
-		const FQuatRotationTranslationMatrix NewLocalToWorld(NewBaseQuat, NewBaseLocation);
-
 		FQuat FinalQuat = UpdatedComponent->GetComponentQuat();
+		const FQuat QuatBeforeBaseMove = FinalQuat;
 
 		if (bRotationChanged && !bIgnoreBaseRotation)
 		{
@@ -3711,12 +4327,11 @@ void URadicalMovementComponent::UpdateBasedMovement(float DeltaTime)
 		CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(Radius, HalfHeight);
 
 		const FVector BaseOffset = GetUpOrientation(MODE_PawnUp) * HalfHeight;
-		const FVector LocalBasePos = OldLocalToWorld.InverseTransformPosition(UpdatedComponent->GetComponentLocation() - BaseOffset);
-		const FVector NewWorldPos = ConstrainLocationToPlane(NewLocalToWorld.TransformPosition(LocalBasePos) + BaseOffset);
+		const FVector NewWorldPos = ConstrainLocationToPlane(BaseDelta.TransformPosition(UpdatedComponent->GetComponentLocation() - BaseOffset) + BaseOffset);
 		DeltaPosition = ConstrainDirectionToPlane(NewWorldPos - UpdatedComponent->GetComponentLocation());
 
 		// Move attached actor
-		FVector BaseMoveDelta = NewBaseLocation - OldBaseLocation;
+		const FVector BaseMoveDelta = BaseDelta.NewLocation - BaseDelta.OldLocation;
 		if (!bRotationChanged && (BaseMoveDelta.X == 0.f) && (BaseMoveDelta.Y == 0.f))
 		{
 			DeltaPosition.X = 0.f;
@@ -3732,6 +4347,11 @@ void URadicalMovementComponent::UpdateBasedMovement(float DeltaTime)
 			OnUnableToFollowBaseMove(DeltaPosition, OldLocation, MoveOnBaseHit);
 		}
 
+		// Carry the previous fixed step along with the base, otherwise the interpolated mesh offset includes the movement of the base
+		const FQuat BaseMoveDeltaQuat = UpdatedComponent->GetComponentQuat() * QuatBeforeBaseMove.Inverse();
+		PreviousSimulatedLocation = UpdatedComponent->GetComponentLocation() + BaseMoveDeltaQuat.RotateVector(PreviousSimulatedLocation - OldLocation);
+		PreviousSimulatedRotation = BaseMoveDeltaQuat * PreviousSimulatedRotation;
+
 		if (MovementBase->IsSimulatingPhysics() && CharacterOwner->GetMesh())
 		{
 			CharacterOwner->GetMesh()->ApplyDeltaToAllPhysicsTransforms(DeltaPosition, DeltaQuat);
@@ -3762,13 +4382,14 @@ void URadicalMovementComponent::SaveBaseLocation()
 		if (MovementBase)
 		{
 			// Read transforms into old base location and quat regardless of whether its movable (because mobility can change)
-			MovementBaseUtility::GetMovementBaseTransform(MovementBase, CharacterOwner->GetBasedMovement().BoneName, OldBaseLocation, OldBaseQuat);
+			const FMovementBaseState BaseState = GetMovementBaseState();
+			OldBaseLocation = BaseState.Location;
+			OldBaseQuat = BaseState.Rotation;
 
 			if (MovementBaseUtility::UseRelativeLocation(MovementBase))
 			{
-				// Relative Location
-				FVector RelativeLocation;
-				MovementBaseUtility::TransformLocationToLocal(MovementBase, CharacterOwner->GetBasedMovement().BoneName, UpdatedComponent->GetComponentLocation(), RelativeLocation);
+				// Relative Location, same as MovementBaseUtility::TransformLocationToLocal without querying the base again
+				const FVector RelativeLocation = OldBaseQuat.UnrotateVector(UpdatedComponent->GetComponentLocation() - OldBaseLocation);
 				
 				// Rotation
 				if (bIgnoreBaseRotation)
@@ -3787,6 +4408,32 @@ void URadicalMovementComponent::SaveBaseLocation()
 	}
 }
 
+void URadicalMovementComponent::AddMovementBaseTickDependency(UPrimitiveComponent* MovementBase)
+{
+	if (bMovementBatched)
+	{
+		if (URadicalMovementSubsystem* MovementSubsystem = GetWorld()->GetSubsystem<URadicalMovementSubsystem>())
+		{
+			MovementSubsystem->AddBaseTickDependency(MovementBase);
+			return;
+		}
+	}
+	MovementBaseUtility::AddTickDependency(PrimaryComponentTick, MovementBase);
+}
+
+void URadicalMovementComponent::RemoveMovementBaseTickDependency(UPrimitiveComponent* MovementBase)
+{
+	if (bMovementBatched)
+	{
+		if (URadicalMovementSubsystem* MovementSubsystem = GetWorld()->GetSubsystem<URadicalMovementSubsystem>())
+		{
+			MovementSubsystem->RemoveBaseTickDependency(MovementBase);
+			return;
+		}
+	}
+	MovementBaseUtility::RemoveTickDependency(PrimaryComponentTick, MovementBase);
+}
+
 void URadicalMovementComponent::OnUnableToFollowBaseMove(const FVector& DeltaPosition, const FVector& OldPosition,
 	const FHitResult& MoveOnBaseHit)
 {
@@ -3932,6 +4579,409 @@ bool URadicalMovementComponent::ShouldComputeAccelerationToReachRequestedVelocit
 #pragma endregion AI 
 
 
+#pragma region Trajectory Prediction
+
+namespace RMCPrediction
+{
+	/* State of every predicted pawn, one entry per pawn. Pawns sharing movement data are contiguous so their velocities go through a single UMovementData::CalculateVelocities */
+	struct FPredictionLanes
+	{
+		TArray<FVector> Locations;
+		TArray<FVector> Velocities;
+		TArray<FVector> Accelerations;							// Input acceleration, held throughout the prediction
+		TArray<FVector> Gravities;
+		TArray<FVector> GravityDirs;
+		TArray<float> TerminalVelocities;
+		TArray<EMovementState> MovementStates;
+		TArray<const UMovementData*> Data;
+		TArray<int32> Components;								// Index of the pawn in the predicted components
+
+		void Init(int32 Num)
+		{
+			Locations.SetNumZeroed(Num);
+			Velocities.SetNumZeroed(Num);
+			Accelerations.SetNumZeroed(Num);
+			Gravities.SetNumZeroed(Num);
+			GravityDirs.Init(FVector::DownVector, Num);
+			TerminalVelocities.SetNumZeroed(Num);
+			MovementStates.Init(STATE_None, Num);
+			Data.Init(nullptr, Num);
+			Components.Init(INDEX_NONE, Num);
+		}
+
+		FORCEINLINE int32 Num() const { return Locations.Num(); }
+	};
+
+	/* Root motion sources of a pawn, cloned so stepping them doesn't advance the live ones */
+	struct FRootMotionLane
+	{
+		int32 Lane = INDEX_NONE;
+		FRootMotionSourceGroupCFW Group;
+		FVector PreAdditiveVelocity = FVector::ZeroVector;
+		bool bAppliedAdditive = false;
+	};
+
+	/// @brief  Integrates the velocities of every lane, one UMovementData::CalculateVelocities per run of pawns sharing movement data
+	static void StepVelocities(FPredictionLanes& L, float DeltaTime)
+	{
+		for (int32 RunStart = 0; RunStart < L.Num();)
+		{
+			int32 RunEnd = RunStart + 1;
+			while (RunEnd < L.Num() && L.Data[RunEnd] == L.Data[RunStart]) RunEnd++;
+
+			const int32 RunLength = RunEnd - RunStart;
+			FMovementVelocityBatch Batch;
+			Batch.Velocities = MakeArrayView(L.Velocities).Slice(RunStart, RunLength);
+			Batch.Accelerations = MakeArrayView(L.Accelerations).Slice(RunStart, RunLength);
+			Batch.Gravities = MakeArrayView(L.Gravities).Slice(RunStart, RunLength);
+			Batch.GravityDirs = MakeArrayView(L.GravityDirs).Slice(RunStart, RunLength);
+			Batch.TerminalVelocities = MakeArrayView(L.TerminalVelocities).Slice(RunStart, RunLength);
+			Batch.MovementStates = MakeArrayView(L.MovementStates).Slice(RunStart, RunLength);
+			L.Data[RunStart]->CalculateVelocities(Batch, DeltaTime);
+
+			RunStart = RunEnd;
+		}
+	}
+
+	static void StepLocations(FPredictionLanes& L, float DeltaTime)
+	{
+		for (int32 i = 0; i < L.Num(); i++)
+		{
+			L.Locations[i] += L.Velocities[i] * DeltaTime;
+		}
+	}
+}
+
+void URadicalMovementComponent::PredictTrajectory(float PredictionTime, int32 NumSteps, TArray<FPredictedTrajectorySample>& OutSamples) const
+{
+	const URadicalMovementComponent* Component = this;
+	PredictTrajectories(MakeArrayView(&Component, 1), PredictionTime, NumSteps, OutSamples);
+}
+
+void URadicalMovementComponent::PredictTrajectories(TConstArrayView<const URadicalMovementComponent*> Components, float PredictionTime, int32 NumSteps, TArray<FPredictedTrajectorySample>& OutSamples)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PredictTrajectory);
+
+	OutSamples.Reset();
+	
+	const int32 NumComponents = Components.Num();
+	if (NumComponents == 0 || NumSteps <= 0 || PredictionTime <= 0.f) return;
+
+	OutSamples.SetNumZeroed(NumComponents * NumSteps);
+	const float StepTime = PredictionTime / NumSteps;
+
+	/* Valid components, ordered by movement data so the lanes of each data asset are contiguous */
+	TArray<int32> Order;
+	Order.Reserve(NumComponents);
+	for (int32 Index = 0; Index < NumComponents; Index++)
+	{
+		const URadicalMovementComponent* Component = Components[Index];
+		if (IsValid(Component) && Component->UpdatedComponent && Component->MovementData && Component->CharacterOwner && Component->GetPhysicsVolume())
+		{
+			Order.Add(Index);
+		}
+	}
+	Order.StableSort([Components](int32 A, int32 B) { return Components[A]->MovementData < Components[B]->MovementData; });
+	
+	RMCPrediction::FPredictionLanes Lanes;
+	Lanes.Init(Order.Num());
+
+	TArray<RMCPrediction::FRootMotionLane> RootMotionLanes;
+
+	/* Gather */
+	for (int32 Lane = 0; Lane < Order.Num(); Lane++)
+	{
+		const URadicalMovementComponent* Component = Components[Order[Lane]];
+		const UMovementData* Data = Component->MovementData;
+
+		Lanes.Components[Lane] = Order[Lane];
+		Lanes.Data[Lane] = Data;
+		Lanes.Locations[Lane] = Component->UpdatedComponent->GetComponentLocation();
+		Lanes.Gravities[Lane] = Component->GetGravity();
+		Lanes.GravityDirs[Lane] = Component->GetGravityDir();
+		Lanes.TerminalVelocities[Lane] = Component->GetPhysicsVolume()->TerminalVelocity;
+		
+		// Movement disabled, the pawn stays where it is
+		if (Component->PhysicsState == STATE_None) continue;
+
+		FVector Acceleration = Component->GetInputAcceleration();
+		
+		// Path following moves the pawn through its requested velocity rather than input. The requested speed is reached through the analog input speed,
+		// which scales with the size of the acceleration
+		if (Acceleration.IsZero() && Component->bHasRequestedVelocity && !Component->RequestedVelocity.IsNearlyZero())
+		{
+			const float MaxSpeed = Data->MaxSpeed * Data->MaxSpeedMultiplier;
+			const float SpeedRatio = (Component->bRequestedMoveWithMaxSpeed || MaxSpeed <= UE_SMALL_NUMBER) ? 1.f : FMath::Min<float>(1.f, Component->RequestedVelocity.Size() / MaxSpeed);
+			Acceleration = Component->RequestedVelocity.GetSafeNormal() * Data->MaxAcceleration * SpeedRatio;
+		}
+
+		Lanes.Velocities[Lane] = Component->GetVelocity();
+		Lanes.Accelerations[Lane] = Acceleration;
+		Lanes.MovementStates[Lane] = Component->PhysicsState;
+
+		if (Component->HasRootMotionSources())
+		{
+			RMCPrediction::FRootMotionLane& RootMotionLane = RootMotionLanes.AddDefaulted_GetRef();
+			RootMotionLane.Lane = Lane;
+			
+			for (const TSharedPtr<FRootMotionSource>& Source : Component->CurrentRootMotion.RootMotionSources)
+			{
+				if (Source.IsValid()) RootMotionLane.Group.RootMotionSources.Add(MakeShareable(Source->Clone()));
+			}
+			for (const TSharedPtr<FRootMotionSource>& Source : Component->CurrentRootMotion.PendingAddRootMotionSources)
+			{
+				if (Source.IsValid()) RootMotionLane.Group.RootMotionSources.Add(MakeShareable(Source->Clone()));
+			}
+		}
+	}
+
+	/* Integrate */
+	for (int32 Step = 0; Step < NumSteps; Step++)
+	{
+		// Additive root motion only lasts for the step it was applied in
+		for (RMCPrediction::FRootMotionLane& RootMotionLane : RootMotionLanes)
+		{
+			if (!RootMotionLane.bAppliedAdditive) continue;
+
+			Lanes.Velocities[RootMotionLane.Lane] = RootMotionLane.PreAdditiveVelocity;
+			RootMotionLane.bAppliedAdditive = false;
+		}
+		
+		RMCPrediction::StepVelocities(Lanes, StepTime);
+
+		for (RMCPrediction::FRootMotionLane& RootMotionLane : RootMotionLanes)
+		{
+			const URadicalMovementComponent& Component = *Components[Lanes.Components[RootMotionLane.Lane]];
+			FRootMotionSourceGroupCFW& Group = RootMotionLane.Group;
+
+			Group.PrepareRootMotion(StepTime, *Component.CharacterOwner, Component, true);
+
+			FVector& Velocity = Lanes.Velocities[RootMotionLane.Lane];
+			if (Group.HasOverrideVelocity())
+			{
+				Group.AccumulateOverrideRootMotionVelocity(StepTime, *Component.CharacterOwner, Component, Velocity);
+			}
+			if (Group.HasAdditiveVelocity())
+			{
+				RootMotionLane.PreAdditiveVelocity = Velocity;
+				RootMotionLane.bAppliedAdditive = true;
+				Group.AccumulateAdditiveRootMotionVelocity(StepTime, *Component.CharacterOwner, Component, Velocity);
+			}
+
+			// Finished sources stop contributing, as CleanUpInvalidRootMotion would between updates
+			Group.RootMotionSources.RemoveAll([](const TSharedPtr<FRootMotionSource>& Source)
+			{
+				return !Source.IsValid() || (Source->IsTimeOutEnabled() && Source->GetTime() >= Source->GetDuration());
+			});
+		}
+
+		RMCPrediction::StepLocations(Lanes, StepTime);
+
+		for (int32 Lane = 0; Lane < Lanes.Num(); Lane++)
+		{
+			FPredictedTrajectorySample& Sample = OutSamples[Lanes.Components[Lane] * NumSteps + Step];
+			Sample.Location = Lanes.Locations[Lane];
+			Sample.Velocity = Lanes.Velocities[Lane];
+		}
+	}
+}
+
+#pragma endregion Trajectory Prediction
+
+
+#pragma region Movement LOD
+
+void URadicalMovementComponent::SetForcedMovementLOD(int32 Tier)
+{
+	ForcedMovementLOD = Tier < 0 ? INDEX_NONE : Tier;
+	MovementLODEvaluationTime = 0.f;
+}
+
+float URadicalMovementComponent::CalculateMovementSignificance() const
+{
+	const UWorld* World = GetWorld();
+	const FVector Location = UpdatedComponent->GetComponentLocation();
+
+	bool bHasViewer = false;
+	float MinDistSquared = UE_BIG_NUMBER;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (!PlayerController || !PlayerController->IsLocalController()) continue;
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		MinDistSquared = FMath::Min(MinDistSquared, FVector::DistSquared(ViewLocation, Location));
+		bHasViewer = true;
+	}
+
+	/* Nobody is watching locally (e.g dedicated server), keep full significance */
+	if (!bHasViewer) return 0.f;
+
+	const float Distance = FMath::Sqrt(MinDistSquared);
+	const bool bOnScreen = CharacterOwner ? CharacterOwner->WasRecentlyRendered(0.2f) : true;
+	return bOnScreen ? Distance : Distance * OffscreenLODDistanceScale;
+}
+
+void URadicalMovementComponent::UpdateMovementLOD(float DeltaTime)
+{
+	if (MovementLODTiers.IsEmpty() || RMCCVars::MovementLOD <= 0)
+	{
+		CurrentMovementLOD = INDEX_NONE;
+		return;
+	}
+
+	const int32 ForcedLOD = RMCCVars::ForceMovementLOD >= 0 ? RMCCVars::ForceMovementLOD : ForcedMovementLOD;
+	if (ForcedLOD != INDEX_NONE)
+	{
+		CurrentMovementLOD = FMath::Min(ForcedLOD, MovementLODTiers.Num() - 1);
+		return;
+	}
+
+	/* The local player always gets the full update */
+	if (PawnOwner && PawnOwner->IsLocallyControlled() && PawnOwner->IsPlayerControlled())
+	{
+		CurrentMovementLOD = 0;
+		return;
+	}
+
+	MovementLODEvaluationTime -= DeltaTime;
+	if (MovementLODEvaluationTime > 0.f && CurrentMovementLOD != INDEX_NONE) return;
+	MovementLODEvaluationTime = MovementLODEvaluationInterval;
+
+	const float Significance = CalculateMovementSignificance();
+	CurrentMovementLOD = MovementLODTiers.Num() - 1;
+	for (int32 Tier = 0; Tier < MovementLODTiers.Num(); Tier++)
+	{
+		if (Significance <= MovementLODTiers[Tier].MaxDistance)
+		{
+			CurrentMovementLOD = Tier;
+			break;
+		}
+	}
+}
+
+bool URadicalMovementComponent::ConsumeMovementLODTime(float& InOutDeltaTime)
+{
+	UpdateMovementLOD(InOutDeltaTime);
+
+	const FMovementLODTier* LODTier = GetMovementLODTier();
+	MovementLODAccumulatedTime += InOutDeltaTime;
+
+	if (LODTier && MovementLODAccumulatedTime < LODTier->UpdateInterval)
+	{
+		INC_DWORD_STAT(STAT_MovementLODSkippedUpdates)
+		UpdateMovementLODSmoothing(InOutDeltaTime);
+
+		/* Input is per frame, the update uses the input of the frame it runs on instead of the sum over the skipped frames */
+		ConsumeInputVector();
+		return false;
+	}
+
+	InOutDeltaTime = MovementLODAccumulatedTime;
+	MovementLODAccumulatedTime = 0.f;
+	return true;
+}
+
+void URadicalMovementComponent::StartMovementLODSmoothing(const FVector& OldRootLocation)
+{
+	const FMovementLODTier* LODTier = GetMovementLODTier();
+	const bool bSmooth = LODTier && LODTier->bSmoothSkippedUpdates && LODTier->UpdateInterval > 0.f;
+	if (!bSmooth && !bMovementLODSmoothing) return;
+
+	/* Carry over whatever offset was left from the previous update */
+	const float PreviousAlpha = MovementLODSmoothingDuration > 0.f ? FMath::Clamp(1.f - MovementLODSmoothingTime / MovementLODSmoothingDuration, 0.f, 1.f) : 0.f;
+	FVector Offset = bSmooth ? (MovementLODSmoothingOffset * PreviousAlpha + OldRootLocation - UpdatedComponent->GetComponentLocation()) : FVector::ZeroVector;
+	if (Offset.SizeSquared() > FMath::Square(MaxMovementLODSmoothingDistance))
+	{
+		Offset = FVector::ZeroVector;
+	}
+
+	MovementLODSmoothingOffset = Offset;
+	MovementLODSmoothingTime = 0.f;
+	MovementLODSmoothingDuration = bSmooth ? LODTier->UpdateInterval : 0.f;
+	UpdateMovementLODSmoothing(0.f);
+}
+
+void URadicalMovementComponent::UpdateMovementLODSmoothing(float DeltaTime)
+{
+	if (!bMovementLODSmoothing && MovementLODSmoothingOffset.IsZero()) return;
+
+	MovementLODSmoothingTime += DeltaTime;
+	const float Alpha = MovementLODSmoothingDuration > 0.f ? FMath::Clamp(1.f - MovementLODSmoothingTime / MovementLODSmoothingDuration, 0.f, 1.f) : 0.f;
+	MovementLODVisualOffset = MovementLODSmoothingOffset * Alpha;
+
+	bMovementLODSmoothing = Alpha > 0.f;
+	if (!bMovementLODSmoothing)
+	{
+		MovementLODSmoothingOffset = FVector::ZeroVector;
+	}
+
+	ApplyMeshVisualOffset();
+}
+
+float URadicalMovementComponent::GetMaxSimulationTimeStep() const
+{
+	const FMovementLODTier* LODTier = GetMovementLODTier();
+	return LODTier && LODTier->MaxSimulationTimeStep > 0.f ? LODTier->MaxSimulationTimeStep : MaxSimulationTimeStep;
+}
+
+int32 URadicalMovementComponent::GetMaxSimulationIterations() const
+{
+	const FMovementLODTier* LODTier = GetMovementLODTier();
+	return LODTier && LODTier->MaxSimulationIterations > 0 ? LODTier->MaxSimulationIterations : FMath::TruncToInt32(MaxSimulationIterations);
+}
+
+#pragma endregion Movement LOD
+
+#pragma region Mesh Visual Offset
+
+void URadicalMovementComponent::ApplyMeshVisualOffset()
+{
+	USkeletalMeshComponent* Mesh = CharacterOwner ? CharacterOwner->GetMesh() : nullptr;
+	if (!Mesh) return;
+
+	const FVector WorldOffset = MovementLODVisualOffset + FixedTimestepVisualOffset;
+	const bool bHasOffset = !WorldOffset.IsNearlyZero() || !FixedTimestepVisualRotation.Equals(FQuat::Identity);
+
+	/* Leave the mesh alone unless we have to offset it or undo a previous offset */
+	if (!bHasOffset && !bMeshVisualOffsetApplied) return;
+
+	const FQuat ComponentRotation = UpdatedComponent->GetComponentQuat();
+	const FVector LocalOffset = ComponentRotation.UnrotateVector(WorldOffset);
+	const FQuat LocalRotation = ComponentRotation.Inverse() * FixedTimestepVisualRotation * ComponentRotation;
+
+	Mesh->SetRelativeLocationAndRotation(CharacterOwner->GetBaseMeshTranslationOffset() + LocalOffset, LocalRotation * CharacterOwner->GetBaseMeshRotationOffset());
+	bMeshVisualOffsetApplied = bHasOffset;
+}
+
+#pragma endregion Mesh Visual Offset
+
+
+#pragma region Scene Query Instrumentation
+
+void URadicalMovementComponent::FlushSceneQueryCounts()
+{
+	LastUpdateQueryCounts = QueryCounts;
+	TotalQueryCounts += QueryCounts;
+	NumQueryUpdates++;
+
+	MovementQueryStats::ReportUpdate(*this, QueryCounts);
+	QueryCounts.Reset();
+}
+
+void URadicalMovementComponent::ResetSceneQueryCounts()
+{
+	QueryCounts.Reset();
+	LastUpdateQueryCounts.Reset();
+	TotalQueryCounts.Reset();
+	NumQueryUpdates = 0;
+}
+
+#pragma endregion Scene Query Instrumentation
+
+
 #pragma region Utility
 
 FVector URadicalMovementComponent::GetCapsuleExtent(const EShrinkCapsuleExtent ShrinkMode,
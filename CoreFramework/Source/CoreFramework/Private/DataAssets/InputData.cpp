@@ -10,67 +10,64 @@
 void UInputBufferMap::GenerateInputActions()
 {
 	InputActions.Empty();
+	ActionIDs = FGameplayTagContainer();
+	ActionIDArray.Empty();
+	ActionIndices.Empty();
+	DirectionalIDs = FGameplayTagContainer();
+	DirectionalIDArray.Empty();
+	DirectionalIndices.Empty();
 
-	for (auto AMap : InputActionMap->GetMappings())
+	if (InputActionMap)
 	{
-		if (!InputActions.Contains(AMap.Action))
+		for (auto AMap : InputActionMap->GetMappings())
 		{
-			const auto BufferedInput = Cast<UBufferedInputAction>(AMap.Action);
-			if (ensureMsgf(BufferedInput, TEXT("Provided input [%s] is not a BufferedInputAction"), *AMap.Action->ActionDescription.ToString()))
-				InputActions.Add(BufferedInput);
+			if (!InputActions.Contains(AMap.Action))
+			{
+				const auto BufferedInput = Cast<UBufferedInputAction>(AMap.Action);
+				if (ensureMsgf(BufferedInput, TEXT("Provided input [%s] is not a BufferedInputAction"), AMap.Action ? *AMap.Action->ActionDescription.ToString() : TEXT("None")))
+					InputActions.Add(BufferedInput);
+			}
 		}
 	}
-}
-
-
-FGameplayTagContainer UInputBufferMap::GetActionIDs()
-{
-	// Check cached value, if not there then we regenerate the IDs
-	if (!ActionIDs.IsEmpty() && ActionIDs.Num() == InputActions.Num())
-	{
-		return ActionIDs;
-	}
-
-	// Regenerate
-	ActionIDs = FGameplayTagContainer();
-
-	// Safety check
-	if (InputActions.IsEmpty()) GenerateInputActions();
 	
 	for (auto Action : InputActions)
 	{
 		ensureMsgf(!ActionIDs.HasTag(Action->GetID()), TEXT("INPUT BUFFER INITIALIZATION ERROR! Tag exists in multiple input actions [%s]"), *Action->GetID().ToString());
 		ensureMsgf(Action->GetID().MatchesTag(TAG_Input_Axis) || Action->GetID().MatchesTag(TAG_Input_Button), TEXT("INPUT BUFFER INITIALIZATION ERROR! Action Input Tag has wrong parent specification [%s]"), *Action->GetID().ToString());
 		ActionIDs.AddTag(Action->GetID());
+		ActionIndices.Add(Action->GetID(), ActionIDArray.Add(Action->GetID()));
 	}
 
-	return ActionIDs;
-}
-
-FGameplayTagContainer UInputBufferMap::GetDirectionalIDs()
-{
 	if (DirectionalActionMap)
 	{
-		// Check cached value, if not there then we regenerate the IDs
-		if (!DirectionalIDs.IsEmpty() && DirectionalIDs.Num() == DirectionalActionMap->GetMappings().Num())
-		{
-			return DirectionalIDs;
-		}
-
-		// Regenerate
-		DirectionalIDs = FGameplayTagContainer();
-		
 		for (auto DMap : DirectionalActionMap->GetMappings())
 		{
+			if (!DMap) continue;
 			ensureMsgf(!DirectionalIDs.HasTag(DMap->GetID()), TEXT("INPUT BUFFER INITIALIZATION ERROR! Tag exists in multiple directional actions [%s]"), *DMap->GetID().ToString());
 			ensureMsgf(DMap->GetID().MatchesTag(TAG_Input_Directional), TEXT("INPUT BUFFER INITIALIZATION ERROR! Action Input Tag has wrong parent specification [%s]"), *DMap->GetID().ToString());
 			DirectionalIDs.AddTag(DMap->GetID());
+			DirectionalIndices.Add(DMap->GetID(), DirectionalIDArray.Add(DMap->GetID()));
 		}
 	}
+}
+
+void UInputBufferMap::PostLoad()
+{
+	Super::PostLoad();
 
-	return DirectionalIDs;
+	// Lookup tables are built once on load so runtime lookups never have to go through the mappings
+	if (InputActionMap) GenerateInputActions();
 }
 
+#if WITH_EDITOR
+void UInputBufferMap::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	
+	if (InputActionMap) GenerateInputActions();
+}
+#endif
+
 
 bool UMotionAction::CheckMotionDirection(const FVector2D& AxisInput, const FVector& ProcessedInput, const FVector& PlayerForward, const FVector& PlayerRight)
 {
@@ -135,17 +132,15 @@ EMotionCommandDirection UMotionAction::GetAxisDirection(const FVector2D& AxisInp
 		return EMotionCommandDirection::NEUTRAL;
 	}
 	
-	FVector ProperAxisInput(AxisInput.X, AxisInput.Y, 0);
-	FVector EvaluationDirection(0, 1, 0);
-	FVector RightDirection(1, 0, 0);
-
 	if (bRelativeToPlayer)
 	{
-		ProperAxisInput = ProcessedInput;
-		EvaluationDirection = PlayerForward;
-		RightDirection = PlayerRight;
+		return ClassifyAxisDirection(ProcessedInput, PlayerForward, PlayerRight);
 	}
+	return ClassifyAxisDirection(FVector(AxisInput.X, AxisInput.Y, 0), FVector(0, 1, 0), FVector(1, 0, 0));
+}
 
+EMotionCommandDirection UMotionAction::ClassifyAxisDirection(const FVector& ProperAxisInput, const FVector& EvaluationDirection, const FVector& RightDirection)
+{
 	const float StickAngle = FMath::RadiansToDegrees(FMath::Acos(ProperAxisInput.GetSafeNormal() | EvaluationDirection.GetSafeNormal()));
 	const bool bRightDirection = (ProperAxisInput | RightDirection) > 0;
 	
@@ -177,3 +172,39 @@ void UMotionAction::UpdateCurrentAngle(const FVector2D& AxisInput)
 }
 
 
+void FMotionCommandAutomaton::Compile(UMotionAction* InAction)
+{
+	Action = InAction;
+	InputID = InAction ? InAction->GetID() : FGameplayTag();
+	Transitions.Reset();
+	AcceptState = 0;
+	
+	if (!InAction) return;
+
+	bAngleChange = InAction->bAngleChange;
+	bRelativeToPlayer = InAction->bRelativeToPlayer;
+	if (bAngleChange) return;
+
+	const int32 NumSteps = FMath::Min(InAction->MotionCommandSequence.Num(), static_cast<int32>(MAX_uint8));
+	AcceptState = NumSteps;
+	
+	// A step only advances when its direction is matched, every other direction stays in place
+	Transitions.SetNumUninitialized(NumSteps * NumDirections);
+	for (int32 Step = 0; Step < NumSteps; Step++)
+	{
+		for (int32 Direction = 0; Direction < NumDirections; Direction++)
+		{
+			const bool bMatchesStep = InAction->MotionCommandSequence[Step].GetValue() == Direction;
+			Transitions[Step * NumDirections + Direction] = static_cast<uint8>(bMatchesStep ? Step + 1 : Step);
+		}
+	}
+
+	Reset();
+}
+
+void FMotionCommandAutomaton::Reset()
+{
+	State = 0;
+	ValidFrame = -1;
+	if (bAngleChange && Action) Action->Reset();
+}
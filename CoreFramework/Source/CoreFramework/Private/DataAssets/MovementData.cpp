@@ -364,6 +364,346 @@ void UMovementData::ApplyGravity(const URadicalMovementComponent* MovementCompon
 
 #pragma endregion Air Specific Acceleration
 
+#pragma region Batch Acceleration
+
+DECLARE_CYCLE_STAT(TEXT("Calculate Velocities (Batch)"), STAT_CalculateVelocitiesBatch, STATGROUP_RadicalMovementComp);
+
+namespace RMCBatchVelocity
+{
+	static constexpr int32 Width = 4;
+	
+	/* 4 vectors, one component per register */
+	struct FVector4x3
+	{
+		VectorRegister4Float X;
+		VectorRegister4Float Y;
+		VectorRegister4Float Z;
+	};
+
+	FORCEINLINE FVector4x3 Add(const FVector4x3& A, const FVector4x3& B)
+	{
+		return { VectorAdd(A.X, B.X), VectorAdd(A.Y, B.Y), VectorAdd(A.Z, B.Z) };
+	}
+
+	FORCEINLINE FVector4x3 Subtract(const FVector4x3& A, const FVector4x3& B)
+	{
+		return { VectorSubtract(A.X, B.X), VectorSubtract(A.Y, B.Y), VectorSubtract(A.Z, B.Z) };
+	}
+
+	FORCEINLINE FVector4x3 Scale(const FVector4x3& A, const VectorRegister4Float& S)
+	{
+		return { VectorMultiply(A.X, S), VectorMultiply(A.Y, S), VectorMultiply(A.Z, S) };
+	}
+
+	/// @brief  A * S + B
+	FORCEINLINE FVector4x3 ScaleAdd(const FVector4x3& A, const VectorRegister4Float& S, const FVector4x3& B)
+	{
+		return { VectorMultiplyAdd(A.X, S, B.X), VectorMultiplyAdd(A.Y, S, B.Y), VectorMultiplyAdd(A.Z, S, B.Z) };
+	}
+
+	FORCEINLINE VectorRegister4Float Dot(const FVector4x3& A, const FVector4x3& B)
+	{
+		return VectorMultiplyAdd(A.X, B.X, VectorMultiplyAdd(A.Y, B.Y, VectorMultiply(A.Z, B.Z)));
+	}
+
+	FORCEINLINE FVector4x3 Select(const VectorRegister4Float& Mask, const FVector4x3& A, const FVector4x3& B)
+	{
+		return { VectorSelect(Mask, A.X, B.X), VectorSelect(Mask, A.Y, B.Y), VectorSelect(Mask, A.Z, B.Z) };
+	}
+
+	FORCEINLINE VectorRegister4Float Not(const VectorRegister4Float& Mask)
+	{
+		return VectorBitwiseXor(Mask, VectorCompareEQ(VectorZeroFloat(), VectorZeroFloat()));
+	}
+
+	FORCEINLINE VectorRegister4Float IsZero(const FVector4x3& A)
+	{
+		const VectorRegister4Float Zero = VectorZeroFloat();
+		return VectorBitwiseAnd(VectorCompareEQ(A.X, Zero), VectorBitwiseAnd(VectorCompareEQ(A.Y, Zero), VectorCompareEQ(A.Z, Zero)));
+	}
+
+	/// @brief  1 / Size, zero where FVector::GetSafeNormal would return a zero vector
+	FORCEINLINE VectorRegister4Float SafeInvSize(const VectorRegister4Float& SizeSquared)
+	{
+		return VectorSelect(VectorCompareLT(SizeSquared, VectorSetFloat1(UE_SMALL_NUMBER)), VectorZeroFloat(), VectorDivide(VectorOneFloat(), VectorSqrt(SizeSquared)));
+	}
+
+	/// @brief  FVector::GetClampedToMaxSize
+	FORCEINLINE FVector4x3 ClampToMaxSize(const FVector4x3& A, const VectorRegister4Float& MaxSize)
+	{
+		const VectorRegister4Float SizeSquared = Dot(A, A);
+		const FVector4x3 Clamped = Scale(A, VectorDivide(MaxSize, VectorSqrt(SizeSquared)));
+		const FVector4x3 Result = Select(VectorCompareGT(SizeSquared, VectorMultiply(MaxSize, MaxSize)), Clamped, A);
+		return Select(VectorCompareLT(MaxSize, VectorSetFloat1(UE_KINDA_SMALL_NUMBER)), FVector4x3{ VectorZeroFloat(), VectorZeroFloat(), VectorZeroFloat() }, Result);
+	}
+
+	/* Lanes of a chunk, gathered from the batch and scattered back once integrated */
+	struct FChunk
+	{
+		alignas(16) float Velocity[3][Width];
+		alignas(16) float Acceleration[3][Width];
+		alignas(16) float Gravity[3][Width];
+		alignas(16) float GravityDir[3][Width];
+		alignas(16) float TerminalVelocity[Width];
+		alignas(16) float Friction[Width];
+		alignas(16) float BrakingDeceleration[Width];
+		alignas(16) float MaxVelBrakingDeceleration[Width];
+		alignas(16) float BrakingFriction[Width];
+		alignas(16) float Active[Width];
+		alignas(16) float Falling[Width];
+
+		FORCEINLINE static void Gather(float (&Lanes)[3][Width], int32 Lane, const FVector& Value)
+		{
+			Lanes[0][Lane] = static_cast<float>(Value.X);
+			Lanes[1][Lane] = static_cast<float>(Value.Y);
+			Lanes[2][Lane] = static_cast<float>(Value.Z);
+		}
+
+		FORCEINLINE static FVector4x3 Load(const float (&Lanes)[3][Width])
+		{
+			return { VectorLoadAligned(Lanes[0]), VectorLoadAligned(Lanes[1]), VectorLoadAligned(Lanes[2]) };
+		}
+
+		FORCEINLINE static void Store(const FVector4x3& Value, float (&Lanes)[3][Width])
+		{
+			VectorStoreAligned(Value.X, Lanes[0]);
+			VectorStoreAligned(Value.Y, Lanes[1]);
+			VectorStoreAligned(Value.Z, Lanes[2]);
+		}
+	};
+
+	/* Friction & braking of a movement state, mirrors the arguments CalculateVelocity passes to CalculateInputVelocity */
+	struct FStateConstants
+	{
+		float Friction = 0.f;
+		float BrakingDeceleration = 0.f;
+		float MaxVelBrakingDeceleration = 0.f;
+		float BrakingFriction = 0.f;
+		bool bActive = false;
+		bool bFalling = false;
+	};
+}
+
+bool UMovementData::HasSameVelocityModel(const UMovementData* Other) const
+{
+	if (Other == this) return true;
+	if (!Other || Other->GetClass() != GetClass()) return false;
+
+	return MaxAcceleration == Other->MaxAcceleration && MaxSpeed == Other->MaxSpeed && MaxSpeedMultiplier == Other->MaxSpeedMultiplier
+		&& TopSpeed == Other->TopSpeed && TopSpeedInterpSpeed == Other->TopSpeedInterpSpeed && MinAnalogSpeed == Other->MinAnalogSpeed
+		&& GroundFriction == Other->GroundFriction && AerialLateralFriction == Other->AerialLateralFriction
+		&& bAccelerationRotates == Other->bAccelerationRotates && bSeparateMaxVelAndInputBrakingDeceleration == Other->bSeparateMaxVelAndInputBrakingDeceleration
+		&& MaxVelBrakingDecelerationGrounded == Other->MaxVelBrakingDecelerationGrounded && MaxVelBrakingDecelerationAerial == Other->MaxVelBrakingDecelerationAerial
+		&& BrakingDecelerationGrounded == Other->BrakingDecelerationGrounded && BrakingFrictionGrounded == Other->BrakingFrictionGrounded
+		&& BrakingDecelerationAerial == Other->BrakingDecelerationAerial && BrakingFrictionAerial == Other->BrakingFrictionAerial
+		&& AirControl == Other->AirControl && AirControlBoostMultiplier == Other->AirControlBoostMultiplier && AirControlBoostVelocityThreshold == Other->AirControlBoostVelocityThreshold
+		&& bUseAccelerationCurve == Other->bUseAccelerationCurve && AccelerationCurve == Other->AccelerationCurve
+		&& bUseForwardFrictionCurve == Other->bUseForwardFrictionCurve && ForwardFrictionCurve == Other->ForwardFrictionCurve
+		&& bUseTurnFrictionCurve == Other->bUseTurnFrictionCurve && TurnFrictionCurve == Other->TurnFrictionCurve
+		&& bUseBrakingDecelerationCurve == Other->bUseBrakingDecelerationCurve && BrakingDecelerationCurve == Other->BrakingDecelerationCurve;
+}
+
+void UMovementData::CalculateVelocities(const FMovementVelocityBatch& Batch, float DeltaTime) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_CalculateVelocitiesBatch);
+	
+	using namespace RMCBatchVelocity;
+
+	if (!ensureMsgf(Batch.IsValid(), TEXT("%s: Every view of the velocity batch should hold the same number of characters"), *GetName())) return;
+	
+	/* Per state constants, resolved once for the whole batch. General uses the grounded values, but isn't on ground or in air for the max velocity decel & braking friction */
+	FStateConstants StateConstants[STATE_General + 1];
+	StateConstants[STATE_Grounded] = { FMath::Max(0.f, GetFriction(STATE_Grounded)), GetMaxBrakingDeceleration(STATE_Grounded), MaxVelBrakingDecelerationGrounded, BrakingFrictionGrounded, true, false };
+	StateConstants[STATE_General] = { FMath::Max(0.f, GetFriction(STATE_Grounded)), GetMaxBrakingDeceleration(STATE_Grounded), MaxVelBrakingDecelerationAerial, BrakingFrictionGrounded, true, false };
+	StateConstants[STATE_Falling] = { FMath::Max(0.f, GetFriction(STATE_Falling)), GetMaxBrakingDeceleration(STATE_Falling), MaxVelBrakingDecelerationAerial, BrakingFrictionAerial, true, true };
+
+	const float MaxSpeedScaled = MaxSpeed * MaxSpeedMultiplier;
+	const float BoostedAirControl = (AirControl != 0.f && AirControlBoostMultiplier > 0.f) ? FMath::Min(1.f, AirControlBoostMultiplier * AirControl) : AirControl;
+	const bool bApplyBraking = DeltaTime >= MIN_DELTA_TIME;
+	
+	const VectorRegister4Float Zero = VectorZeroFloat();
+	const VectorRegister4Float One = VectorOneFloat();
+	const VectorRegister4Float VDeltaTime = VectorSetFloat1(DeltaTime);
+	const VectorRegister4Float VMaxSpeed = VectorSetFloat1(MaxSpeedScaled);
+	const VectorRegister4Float VMaxSpeedSquared = VectorSetFloat1(FMath::Square(MaxSpeedScaled));
+	const VectorRegister4Float VOverMaxSpeedSquared = VectorSetFloat1(FMath::Square(FMath::Max(0.f, MaxSpeedScaled)) * 1.01f); // UMovementComponent::IsExceedingMaxSpeed
+	const VectorRegister4Float VMaxAcceleration = VectorSetFloat1(MaxAcceleration);
+	const VectorRegister4Float VMinAnalogSpeed = VectorSetFloat1(MinAnalogSpeed);
+	const VectorRegister4Float VTopSpeed = VectorSetFloat1(TopSpeed);
+	const VectorRegister4Float VTopSpeedAlpha = VectorSetFloat1(DeltaTime * TopSpeedInterpSpeed);
+	const VectorRegister4Float VAirControl = VectorSetFloat1(AirControl);
+	const VectorRegister4Float VBoostedAirControl = VectorSetFloat1(BoostedAirControl);
+	const VectorRegister4Float VAirControlBoostThresholdSquared = VectorSetFloat1(FMath::Square(AirControlBoostVelocityThreshold));
+	const VectorRegister4Float VBrakeToStopSquared = VectorSetFloat1(FMath::Square(BRAKE_TO_STOP_VELOCITY));
+	const VectorRegister4Float VKindaSmall = VectorSetFloat1(UE_KINDA_SMALL_NUMBER);
+	const VectorRegister4Float VOverMaxPercent = VectorSetFloat1(1.01f);
+	const VectorRegister4Float bHasMaxAcceleration = MaxAcceleration > UE_SMALL_NUMBER ? VectorCompareEQ(Zero, Zero) : Zero;
+
+	/* Curves are sampled per lane, only when they're used */
+	auto SampleCurveLanes = [MaxSpeedScaled](const UCurveFloat* Curve, bool bSampleStatus, const VectorRegister4Float& Speed)
+	{
+		if (!bSampleStatus || !Curve) return VectorOneFloat();
+		
+		alignas(16) float Lanes[Width];
+		VectorStoreAligned(Speed, Lanes);
+		for (int32 Lane = 0; Lane < Width; Lane++)
+		{
+			Lanes[Lane] = Curve->GetFloatValue(Lanes[Lane] / MaxSpeedScaled);
+		}
+		return VectorLoadAligned(Lanes);
+	};
+
+	FChunk Chunk;
+	for (int32 ChunkStart = 0; ChunkStart < Batch.Num(); ChunkStart += Width)
+	{
+		const int32 NumLanes = FMath::Min(Width, Batch.Num() - ChunkStart);
+
+		/* Gather, padding lanes are inactive */
+		for (int32 Lane = 0; Lane < Width; Lane++)
+		{
+			const int32 Index = ChunkStart + Lane;
+			const bool bValidLane = Lane < NumLanes;
+			const EMovementState State = bValidLane ? Batch.MovementStates[Index] : STATE_None;
+			const FStateConstants& Constants = (State >= STATE_None && State <= STATE_General) ? StateConstants[State] : StateConstants[STATE_None];
+
+			FChunk::Gather(Chunk.Velocity, Lane, bValidLane ? Batch.Velocities[Index] : FVector::ZeroVector);
+			FChunk::Gather(Chunk.Acceleration, Lane, bValidLane ? Batch.Accelerations[Index] : FVector::ZeroVector);
+			FChunk::Gather(Chunk.Gravity, Lane, bValidLane ? Batch.Gravities[Index] : FVector::ZeroVector);
+			FChunk::Gather(Chunk.GravityDir, Lane, bValidLane ? Batch.GravityDirs[Index] : FVector::DownVector);
+			Chunk.TerminalVelocity[Lane] = bValidLane ? FMath::Abs(Batch.TerminalVelocities[Index]) : 0.f;
+			Chunk.Friction[Lane] = Constants.Friction;
+			Chunk.BrakingDeceleration[Lane] = Constants.BrakingDeceleration;
+			Chunk.MaxVelBrakingDeceleration[Lane] = Constants.MaxVelBrakingDeceleration;
+			Chunk.BrakingFriction[Lane] = Constants.BrakingFriction;
+			Chunk.Active[Lane] = Constants.bActive ? 1.f : 0.f;
+			Chunk.Falling[Lane] = Constants.bFalling ? 1.f : 0.f;
+		}
+
+		const FVector4x3 OldVelocity = FChunk::Load(Chunk.Velocity);
+		const FVector4x3 InputAcceleration = FChunk::Load(Chunk.Acceleration);
+		const FVector4x3 GravityDir = FChunk::Load(Chunk.GravityDir);
+		const VectorRegister4Float bActive = VectorCompareGT(VectorLoadAligned(Chunk.Active), Zero);
+		const VectorRegister4Float bFalling = VectorCompareGT(VectorLoadAligned(Chunk.Falling), Zero);
+		const VectorRegister4Float Friction = VectorLoadAligned(Chunk.Friction);
+
+		/* Falling: Lateral acceleration with air control, input velocity only acts on the velocity planar to gravity (GetFallingLateralAcceleration) */
+		FVector4x3 FallAcceleration = { InputAcceleration.X, InputAcceleration.Y, Zero };
+		{
+			const VectorRegister4Float bBoostAirControl = VectorCompareLT(VectorMultiplyAdd(OldVelocity.X, OldVelocity.X, VectorMultiply(OldVelocity.Y, OldVelocity.Y)), VAirControlBoostThresholdSquared);
+			FallAcceleration = Scale(FallAcceleration, VectorSelect(bBoostAirControl, VBoostedAirControl, VAirControl));
+			FallAcceleration = ClampToMaxSize(FallAcceleration, VMaxAcceleration);
+			FallAcceleration = Subtract(FallAcceleration, Scale(GravityDir, Dot(FallAcceleration, GravityDir)));
+		}
+		const FVector4x3 VerticalVelocity = Select(bFalling, Scale(GravityDir, VectorDivide(Dot(OldVelocity, GravityDir), Dot(GravityDir, GravityDir))), FVector4x3{ Zero, Zero, Zero });
+
+		const FVector4x3 Acceleration = Select(bFalling, FallAcceleration, InputAcceleration);
+		FVector4x3 Velocity = Subtract(OldVelocity, VerticalVelocity);
+
+		/* Input velocity, mirrors CalculateInputVelocity */
+		{
+			const VectorRegister4Float AccelSizeSquared = Dot(Acceleration, Acceleration);
+			const VectorRegister4Float AccelSize = VectorSqrt(AccelSizeSquared);
+			const VectorRegister4Float AnalogInputModifier = VectorSelect(VectorBitwiseAnd(VectorCompareGT(AccelSizeSquared, Zero), bHasMaxAcceleration),
+				VectorMin(VectorMax(VectorDivide(AccelSize, VMaxAcceleration), Zero), One), Zero);
+			const VectorRegister4Float MaxInputSpeed = VectorMax(VectorMultiply(VMaxSpeed, AnalogInputModifier), VMinAnalogSpeed);
+			
+			const VectorRegister4Float SpeedSquared = Dot(Velocity, Velocity);
+			const VectorRegister4Float Speed = VectorSqrt(SpeedSquared);
+			const VectorRegister4Float bZeroAcceleration = IsZero(Acceleration);
+			const VectorRegister4Float bVelocityOverMax = VectorCompareGT(SpeedSquared, VOverMaxSpeedSquared);
+			const VectorRegister4Float TurnFrictionFactor = SampleCurveLanes(TurnFrictionCurve, bUseTurnFrictionCurve, Speed);
+			const VectorRegister4Float ForwardFrictionFactor = SampleCurveLanes(ForwardFrictionCurve, bUseForwardFrictionCurve, Speed);
+
+			const VectorRegister4Float BrakingDeceleration = VectorLoadAligned(Chunk.BrakingDeceleration);
+			const VectorRegister4Float MaxVelBrakingDecel = VectorLoadAligned(Chunk.MaxVelBrakingDeceleration);
+			const VectorRegister4Float BrakingDecelerationToUse = bSeparateMaxVelAndInputBrakingDeceleration
+				? VectorSelect(bVelocityOverMax, VectorSelect(bZeroAcceleration, VectorMax(MaxVelBrakingDecel, BrakingDeceleration), MaxVelBrakingDecel), BrakingDeceleration)
+				: BrakingDeceleration;
+
+			/* Braking where there is no acceleration or we are over max speed (ApplyVelocityBraking) */
+			const VectorRegister4Float bBraking = VectorBitwiseOr(bZeroAcceleration, bVelocityOverMax);
+			FVector4x3 BrakedVelocity = Velocity;
+			if (bApplyBraking && VectorMaskBits(bBraking))
+			{
+				const VectorRegister4Float BrakingFriction = VectorMax(Zero, VectorMultiply(VectorLoadAligned(Chunk.BrakingFriction), SampleCurveLanes(BrakingDecelerationCurve, bUseBrakingDecelerationCurve, Speed)));
+				const VectorRegister4Float BrakingDecel = VectorMax(Zero, BrakingDecelerationToUse);
+				
+				const FVector4x3 RevAccel = Scale(Velocity, VectorMultiply(VectorSubtract(Zero, BrakingDecel), SafeInvSize(SpeedSquared)));
+				FVector4x3 NewVelocity = ScaleAdd(Subtract(RevAccel, Scale(Velocity, BrakingFriction)), VDeltaTime, Velocity);
+
+				/* Don't reverse direction, clamp to zero if nearly zero or below min threshold */
+				const VectorRegister4Float NewSpeedSquared = Dot(NewVelocity, NewVelocity);
+				const VectorRegister4Float bStop = VectorBitwiseOr(VectorCompareLE(Dot(NewVelocity, Velocity), Zero),
+					VectorBitwiseOr(VectorCompareLE(NewSpeedSquared, VKindaSmall), VectorCompareLE(NewSpeedSquared, VBrakeToStopSquared)));
+				NewVelocity = Select(bStop, FVector4x3{ Zero, Zero, Zero }, NewVelocity);
+
+				const VectorRegister4Float bSkipBraking = VectorBitwiseOr(IsZero(Velocity), VectorCompareEQ(BrakingDecel, Zero));
+				BrakedVelocity = Select(bSkipBraking, Velocity, NewVelocity);
+			}
+			
+			/* Don't allow braking to lower us below max speed if we started above it and input is still in the same direction */
+			{
+				const VectorRegister4Float bKeepMaxSpeed = VectorBitwiseAnd(bVelocityOverMax,
+					VectorBitwiseAnd(VectorCompareLT(Dot(BrakedVelocity, BrakedVelocity), VMaxSpeedSquared), VectorCompareGT(Dot(Acceleration, Velocity), Zero)));
+				BrakedVelocity = Select(bKeepMaxSpeed, Scale(BrakedVelocity, VectorMultiply(SafeInvSize(Dot(BrakedVelocity, BrakedVelocity)), VMaxSpeed)), BrakedVelocity);
+			}
+
+			/* (Non-Braking) Friction affects our ability to change direction */
+			const FVector4x3 AccelDir = Scale(Acceleration, SafeInvSize(AccelSizeSquared));
+			const FVector4x3 TargetVelocity = Subtract(Velocity, Scale(Subtract(Velocity, Scale(AccelDir, VectorMultiply(ForwardFrictionFactor, Speed))),
+				VectorMin(VectorMultiply(VDeltaTime, VectorMultiply(Friction, TurnFrictionFactor)), One)));
+
+			Velocity = Select(bBraking, BrakedVelocity, Select(bZeroAcceleration, Velocity, TargetVelocity));
+
+			/* Apply input acceleration, scaling factors are only applied to components parallel to velocity */
+			if (VectorMaskBits(bZeroAcceleration) != 0xF)
+			{
+				const VectorRegister4Float NewSpeedSquared = Dot(Velocity, Velocity);
+				const VectorRegister4Float NewSpeed = VectorSqrt(NewSpeedSquared);
+				const VectorRegister4Float ClampedMaxInputSpeed = VectorMax(Zero, MaxInputSpeed);
+				const VectorRegister4Float NewMaxInputSpeed = VectorSelect(VectorCompareGT(SpeedSquared, VectorMultiply(VectorMultiply(ClampedMaxInputSpeed, ClampedMaxInputSpeed), VOverMaxPercent)), NewSpeed, MaxInputSpeed);
+				const VectorRegister4Float AccelFactor = SampleCurveLanes(AccelerationCurve, bUseAccelerationCurve, NewSpeed);
+
+				const FVector4x3 VelocityDir = Scale(Velocity, SafeInvSize(NewSpeedSquared));
+				const FVector4x3 ParallelAcceleration = Scale(VelocityDir, Dot(Acceleration, VelocityDir));
+				const FVector4x3 ScaledAcceleration = Select(VectorCompareGT(Dot(Velocity, Acceleration), Zero),
+					ScaleAdd(ParallelAcceleration, AccelFactor, Subtract(Acceleration, ParallelAcceleration)), Acceleration);
+
+				Velocity = Select(bZeroAcceleration, Velocity, ClampToMaxSize(ScaleAdd(ScaledAcceleration, VDeltaTime, Velocity), NewMaxInputSpeed));
+			}
+		}
+
+		/* Top speed, falling always interpolates from TopSpeed */
+		{
+			const VectorRegister4Float Speed = VectorSqrt(Dot(Velocity, Velocity));
+			const VectorRegister4Float StartTopSpeed = VectorSelect(VectorBitwiseOr(bFalling, VectorCompareLE(Speed, VTopSpeed)), VTopSpeed, Speed);
+			const VectorRegister4Float InstanceTopSpeed = VectorMultiplyAdd(VectorSubtract(VTopSpeed, StartTopSpeed), VTopSpeedAlpha, StartTopSpeed);
+			Velocity = ClampToMaxSize(Velocity, InstanceTopSpeed);
+		}
+
+		/* Falling: Restore vertical velocity and apply gravity (ApplyGravity) */
+		{
+			const VectorRegister4Float TerminalLimit = VectorLoadAligned(Chunk.TerminalVelocity);
+			FVector4x3 FallVelocity = ScaleAdd(FChunk::Load(Chunk.Gravity), VDeltaTime, Add(Velocity, VerticalVelocity));
+
+			const VectorRegister4Float FallSpeedAlongGravity = Dot(FallVelocity, GravityDir);
+			const VectorRegister4Float bTerminal = VectorBitwiseAnd(VectorCompareGT(Dot(FallVelocity, FallVelocity), VectorMultiply(TerminalLimit, TerminalLimit)), VectorCompareGT(FallSpeedAlongGravity, TerminalLimit));
+			FallVelocity = Select(bTerminal, ScaleAdd(GravityDir, VectorSubtract(TerminalLimit, FallSpeedAlongGravity), FallVelocity), FallVelocity);
+
+			Velocity = Select(bFalling, FallVelocity, Velocity);
+		}
+
+		/* Scatter, inactive lanes (STATE_None) keep their velocity */
+		FChunk::Store(Select(bActive, Velocity, OldVelocity), Chunk.Velocity);
+		for (int32 Lane = 0; Lane < NumLanes; Lane++)
+		{
+			Batch.Velocities[ChunkStart + Lane] = FVector(Chunk.Velocity[0][Lane], Chunk.Velocity[1][Lane], Chunk.Velocity[2][Lane]);
+		}
+	}
+}
+
+#pragma endregion Batch Acceleration
+
 #pragma region Rotation
 
 void UMovementData::PhysicsRotation(URadicalMovementComponent* MovementComponent, float DeltaTime)
@@ -6,6 +6,7 @@
 #include "Components/RadicalMovementComponent.h"
 #include "Curves/CurveVector.h"
 #include "Curves/CurveFloat.h"
+#include "DataStructures/CurveLookupTable.h"
 #include "RootMotionTasks/RootMotionTask_Base.h"
 
 #pragma region Utility
@@ -54,23 +55,28 @@ void RootMotionSourceCFWDebug::PrintOnScreenServerMsg(const FString& InString)
 
 const float RootMotionSource_InvalidStartTime = -UE_BIG_NUMBER;
 
+namespace RootMotionSourceCFWCVars
+{
+	static float JumpPathMaxError = 0.1f;
+	FAutoConsoleVariableRef CVarJumpPathMaxError
+	(
+		TEXT("cfw.RootMotion.JumpForce.PathMaxError"),
+		JumpPathMaxError,
+		TEXT("Max distance (cm) between a jump force's baked path and its curves, checked halfway between samples. Paths that can't meet it are evaluated directly"),
+		ECVF_Default
+	);
+}
 
+
+/* Curves are sampled through their baked lookup tables, @see CurveLUT */
 static float EvaluateFloatCurveAtFraction(const UCurveFloat& Curve, const float Fraction)
 {
-	float MinCurveTime(0.f);
-	float MaxCurveTime(1.f);
-
-	Curve.GetTimeRange(MinCurveTime, MaxCurveTime);
-	return Curve.GetFloatValue(FMath::GetRangeValue(FVector2f(MinCurveTime, MaxCurveTime), Fraction));
+	return CurveLUT::EvaluateFloatAtFraction(Curve, Fraction);
 }
 
 static FVector EvaluateVectorCurveAtFraction(const UCurveVector& Curve, const float Fraction)
 {
-	float MinCurveTime(0.f);
-	float MaxCurveTime(1.f);
-
-	Curve.GetTimeRange(MinCurveTime, MaxCurveTime);
-	return Curve.GetVectorValue(FMath::GetRangeValue(FVector2f(MinCurveTime, MaxCurveTime), Fraction));
+	return CurveLUT::EvaluateVectorAtFraction(Curve, Fraction);
 }
 
 #pragma endregion Utility
@@ -84,6 +90,8 @@ void FRootMotionSourceCFW::PrepareCustomRootMotion(float SimulationTime, float M
 
 void FRootMotionSourceGroupCFW::CleanUpInvalidRootMotion(float DeltaTime, const ARadicalCharacter& Character, URadicalMovementComponent& MoveComponent)
 {
+	if (RootMotionSources.IsEmpty() && PendingAddRootMotionSources.IsEmpty()) return;
+	
 	// Remove active sources marked for removal or that are invalid
 	RootMotionSources.RemoveAll([this, DeltaTime, &Character, &MoveComponent](const TSharedPtr<FRootMotionSource>& RootSource)
 	{
@@ -183,10 +191,11 @@ void FRootMotionSourceGroupCFW::CleanUpInvalidRootMotion(float DeltaTime, const
 
 void FRootMotionSourceGroupCFW::PrepareRootMotion(float DeltaTime, const ARadicalCharacter& Character, const URadicalMovementComponent& MoveComponent, bool bForcePrepareAll)
 {
-	// Add pending sources
+	// Add pending sources. Reset keeps the allocation around for the next sources applied
+	if (PendingAddRootMotionSources.Num() > 0)
 	{
 		RootMotionSources.Append(PendingAddRootMotionSources);
-		PendingAddRootMotionSources.Empty();
+		PendingAddRootMotionSources.Reset();
 	}
 
 	// Sort by priority
@@ -389,6 +398,16 @@ void FRootMotionSourceGroupCFW::ClearAndDestroy()
 }
 
 
+int32 FRootMotionSourcePoolCFW::Num() const
+{
+	int32 NumSources = 0;
+	for (const auto& Pool : Pools)
+	{
+		NumSources += Pool.Value.Num();
+	}
+	return NumSources;
+}
+
 #pragma endregion Source Group
 
 #pragma region Constant Force
@@ -460,7 +479,7 @@ void FRootMotionSourceCFW_ConstantForce::PrepareCustomRootMotion
 	if (StrengthOverTime)
 	{
 		const float TimeValue = Duration > 0.f ? FMath::Clamp(GetTime() / Duration, 0.f, 1.f) : GetTime();
-		const float TimeFactor = StrengthOverTime->GetFloatValue(TimeValue);
+		const float TimeFactor = CurveLUT::EvaluateFloat(*StrengthOverTime, TimeValue);
 		NewTransform.ScaleTranslation(TimeFactor);
 	}
 
@@ -595,14 +614,14 @@ void FRootMotionSourceCFW_RadialForce::PrepareCustomRootMotion
 			float AdditiveStrengthFactor = 1.f;
 			if (StrengthDistanceFalloff)
 			{
-				const float DistanceFactor = StrengthDistanceFalloff->GetFloatValue(FMath::Clamp(Distance / Radius, 0.f, 1.f));
+				const float DistanceFactor = CurveLUT::EvaluateFloat(*StrengthDistanceFalloff, FMath::Clamp(Distance / Radius, 0.f, 1.f));
 				AdditiveStrengthFactor -= (1.f - DistanceFactor);
 			}
 
 			if (StrengthOverTime)
 			{
 				const float TimeValue = Duration > 0.f ? FMath::Clamp(GetTime() / Duration, 0.f, 1.f) : GetTime();
-				const float TimeFactor = StrengthOverTime->GetFloatValue(TimeValue);
+				const float TimeFactor = CurveLUT::EvaluateFloat(*StrengthOverTime, TimeValue);
 				AdditiveStrengthFactor -= (1.f - TimeFactor);
 			}
 
@@ -1061,7 +1080,7 @@ bool FRootMotionSourceCFW_JumpForce::IsTimeOutEnabled() const
 	{
 		return false;
 	}
-	return FRootMotionSourceCFW_JumpForce::IsTimeOutEnabled();
+	return FRootMotionSource::IsTimeOutEnabled();
 }
 
 FRootMotionSource* FRootMotionSourceCFW_JumpForce::Clone() const
@@ -1147,6 +1166,80 @@ FVector FRootMotionSourceCFW_JumpForce::GetRelativeLocation(float MoveFraction)
 	return FacingRotation.RotateVector(RelativeLocationFacingSpace);
 }
 
+void FRootMotionSourceCFW_JumpForce::BakePath()
+{
+	FRotator FacingRotation(Rotation);
+	FacingRotation.Pitch = 0.f;
+	FacingQuat = FacingRotation.Quaternion();
+	
+	NumPathSegments = 0;
+	bPathBaked = true;
+
+	if (!PathOffsetCurve && !TimeMappingCurve) return;
+
+	// Sized for the finest resolution up front, a recycled source keeps this allocation (@see FRootMotionJumpPathCFW)
+	Path.Positions.Reset(MaxPathSegments + 1);
+	Path.Tangents.Reset(MaxPathSegments + 1);
+
+	const float MaxErrorSq = FMath::Square(FMath::Max(RootMotionSourceCFWCVars::JumpPathMaxError, 0.f));
+	bool bWithinError = false;
+	
+	for (int32 NumSegments = 16; NumSegments <= MaxPathSegments && !bWithinError; NumSegments *= 2)
+	{
+		Path.Positions.SetNumUninitialized(NumSegments + 1);
+		Path.Tangents.SetNumUninitialized(NumSegments + 1);
+		
+		for (int32 Index = 0; Index <= NumSegments; Index++)
+		{
+			Path.Positions[Index] = FVector3f(EvaluatePath(static_cast<float>(Index) / NumSegments));
+		}
+
+		// Central differences inside, one sided at the ends
+		for (int32 Index = 0; Index <= NumSegments; Index++)
+		{
+			const int32 Prev = FMath::Max(Index - 1, 0);
+			const int32 Next = FMath::Min(Index + 1, NumSegments);
+			Path.Tangents[Index] = (Path.Positions[Next] - Path.Positions[Prev]) * (static_cast<float>(NumSegments) / (Next - Prev));
+		}
+		NumPathSegments = NumSegments;
+
+		bWithinError = true;
+		for (int32 Segment = 0; Segment < NumSegments && bWithinError; Segment++)
+		{
+			const float MidFraction = (Segment + 0.5f) / NumSegments;
+			bWithinError = FVector::DistSquared(GetPathLocation(MidFraction), EvaluatePath(MidFraction)) <= MaxErrorSq;
+		}
+	}
+
+	// Stepped or discontinuous curves can't be fit by smooth segments, evaluate them directly rather than smear the steps
+	if (!bWithinError)
+	{
+		NumPathSegments = 0;
+		Path.Positions.Reset();
+		Path.Tangents.Reset();
+	}
+}
+
+FVector FRootMotionSourceCFW_JumpForce::EvaluatePath(float TimeFraction) const
+{
+	const float MoveFraction = TimeMappingCurve ? EvaluateFloatCurveAtFraction(*TimeMappingCurve, TimeFraction) : TimeFraction;
+	return FVector(MoveFraction * Distance, 0.f, 0.f) + GetPathOffset(MoveFraction);
+}
+
+FVector FRootMotionSourceCFW_JumpForce::GetPathLocation(float TimeFraction) const
+{
+	if (NumPathSegments == 0 || TimeFraction < 0.f || TimeFraction > 1.f)
+	{
+		return EvaluatePath(TimeFraction);
+	}
+
+	const float X = TimeFraction * NumPathSegments;
+	const int32 Segment = FMath::Min(FMath::FloorToInt32(X), NumPathSegments - 1);
+	const float SegmentLength = 1.f / NumPathSegments;
+	
+	return FVector(FMath::CubicInterp(Path.Positions[Segment], Path.Tangents[Segment] * SegmentLength, Path.Positions[Segment + 1], Path.Tangents[Segment + 1] * SegmentLength, X - Segment));
+}
+
 void FRootMotionSourceCFW_JumpForce::PrepareCustomRootMotion
 	(
 		float SimulationTime, 
@@ -1171,17 +1264,10 @@ void FRootMotionSourceCFW_JumpForce::PrepareCustomRootMotion
 			CurrentTimeFraction -= TimeFractionPastAllowable;
 		}
 
-		float CurrentMoveFraction = CurrentTimeFraction;
-		float TargetMoveFraction = TargetTimeFraction;
-
-		if (TimeMappingCurve)
-		{
-			CurrentMoveFraction = EvaluateFloatCurveAtFraction(*TimeMappingCurve, CurrentMoveFraction);
-			TargetMoveFraction  = EvaluateFloatCurveAtFraction(*TimeMappingCurve, TargetMoveFraction);
-		}
+		if (!bPathBaked) BakePath();
 
-		const FVector CurrentRelativeLocation = GetRelativeLocation(CurrentMoveFraction);
-		const FVector TargetRelativeLocation = GetRelativeLocation(TargetMoveFraction);
+		const FVector CurrentRelativeLocation = FacingQuat.RotateVector(GetPathLocation(CurrentTimeFraction));
+		const FVector TargetRelativeLocation = FacingQuat.RotateVector(GetPathLocation(TargetTimeFraction));
 
 		const FVector Force = (TargetRelativeLocation - CurrentRelativeLocation) / MovementTickTime;
 
@@ -1229,8 +1315,8 @@ void FRootMotionSourceCFW_JumpForce::PrepareCustomRootMotion
 				*Force.ToString());
 
 			{
-				FString AdjustedDebugString = FString::Printf(TEXT("    FRootMotionSource_JumpForce::Prep Force(%s) SimTime(%.3f) MoveTime(%.3f) StartP(%.3f) EndP(%.3f)"),
-					*Force.ToCompactString(), SimulationTime, MovementTickTime, CurrentMoveFraction, TargetMoveFraction);
+				FString AdjustedDebugString = FString::Printf(TEXT("    FRootMotionSource_JumpForce::Prep Force(%s) SimTime(%.3f) MoveTime(%.3f) StartT(%.3f) EndT(%.3f)"),
+					*Force.ToCompactString(), SimulationTime, MovementTickTime, CurrentTimeFraction, TargetTimeFraction);
 				RootMotionSourceCFWDebug::PrintOnScreen(Character, AdjustedDebugString);
 			}
 		}
@@ -0,0 +1,303 @@
+﻿// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#include "CurveLookupTable.h"
+
+#include "Curves/CurveFloat.h"
+#include "Curves/CurveVector.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectGlobals.h"
+
+
+namespace CurveLUTCVars
+{
+	static int32 EnableCurveLUT = 1;
+	FAutoConsoleVariableRef CVarEnableCurveLUT
+	(
+		TEXT("cfw.RootMotion.CurveLUT"),
+		EnableCurveLUT,
+		TEXT("Whether curves sampled by root motion sources are evaluated through baked lookup tables. 0: Disable, 1: Enable"),
+		ECVF_Default
+	);
+
+	static float MaxError = 0.001f;
+	FAutoConsoleVariableRef CVarMaxError
+	(
+		TEXT("cfw.RootMotion.CurveLUT.MaxError"),
+		MaxError,
+		TEXT("Max difference between a baked table and its curve, checked halfway between samples. Changing it rebakes every table"),
+		FConsoleVariableDelegate::CreateLambda([](IConsoleVariable*) { CurveLUT::Invalidate(); }),
+		ECVF_Default
+	);
+
+	static int32 MaxSamples = 1024;
+	FAutoConsoleVariableRef CVarMaxSamples
+	(
+		TEXT("cfw.RootMotion.CurveLUT.MaxSamples"),
+		MaxSamples,
+		TEXT("Max number of samples baked per curve, curves that can't meet MaxError stop there. Changing it rebakes every table"),
+		FConsoleVariableDelegate::CreateLambda([](IConsoleVariable*) { CurveLUT::Invalidate(); }),
+		ECVF_Default
+	);
+}
+
+namespace CurveLUT
+{
+	/* Uniformly sampled curve, channels interleaved per sample */
+	struct FBakedCurve
+	{
+		TArray<float> Samples;
+		float MinTime = 0.f;
+		float MaxTime = 0.f;
+		float SamplesPerTime = 0.f;
+		int32 NumSegments = 0;
+		int32 NumChannels = 0;
+
+		/* Curves with no range (no keys or a single one) are cheap enough to evaluate directly, stepped curves can't be interpolated */
+		bool IsValid() const { return NumSegments > 0; }
+
+		FORCEINLINE bool IsInRange(float Time) const { return Time >= MinTime && Time <= MaxTime; }
+
+		FORCEINLINE void Sample(float Time, float* OutValues) const
+		{
+			const float X = (Time - MinTime) * SamplesPerTime;
+			const int32 Segment = FMath::Clamp(FMath::FloorToInt32(X), 0, NumSegments - 1);
+			const float Alpha = X - Segment;
+			
+			const float* A = &Samples[Segment * NumChannels];
+			const float* B = A + NumChannels;
+			for (int32 Channel = 0; Channel < NumChannels; Channel++)
+			{
+				OutValues[Channel] = FMath::Lerp(A[Channel], B[Channel], Alpha);
+			}
+		}
+	};
+
+	/// @brief  Samples the curve at NumSegments + 1 evenly spaced times, doubling NumSegments until the midpoints of every segment are within MaxError
+	template<int32 NumChannels, typename EvalFunc>
+	static void Bake(FBakedCurve& OutBaked, float MinTime, float MaxTime, EvalFunc&& Eval)
+	{
+		OutBaked = FBakedCurve();
+		OutBaked.NumChannels = NumChannels;
+		OutBaked.MinTime = MinTime;
+		OutBaked.MaxTime = MaxTime;
+		
+		if (MaxTime - MinTime <= UE_KINDA_SMALL_NUMBER) return;
+
+		const int32 MaxSegments = FMath::Max(CurveLUTCVars::MaxSamples - 1, 1);
+		const float MaxError = FMath::Max(CurveLUTCVars::MaxError, 0.f);
+		
+		for (int32 NumSegments = FMath::Min(16, MaxSegments); ; NumSegments = FMath::Min(NumSegments * 2, MaxSegments))
+		{
+			const float SegmentTime = (MaxTime - MinTime) / NumSegments;
+			
+			OutBaked.Samples.SetNumUninitialized((NumSegments + 1) * NumChannels);
+			for (int32 Index = 0; Index <= NumSegments; Index++)
+			{
+				Eval(Index < NumSegments ? MinTime + Index * SegmentTime : MaxTime, &OutBaked.Samples[Index * NumChannels]);
+			}
+			OutBaked.NumSegments = NumSegments;
+			OutBaked.SamplesPerTime = NumSegments / (MaxTime - MinTime);
+
+			if (NumSegments == MaxSegments) return;
+
+			bool bWithinError = true;
+			for (int32 Segment = 0; Segment < NumSegments && bWithinError; Segment++)
+			{
+				const float MidTime = MinTime + (Segment + 0.5f) * SegmentTime;
+				
+				float Exact[NumChannels], Baked[NumChannels];
+				Eval(MidTime, Exact);
+				OutBaked.Sample(MidTime, Baked);
+				
+				for (int32 Channel = 0; Channel < NumChannels; Channel++)
+				{
+					bWithinError &= FMath::Abs(Exact[Channel] - Baked[Channel]) <= MaxError;
+				}
+			}
+			if (bWithinError) return;
+		}
+	}
+
+	/// @brief  Whether the curve jumps between values, through constant keys or keys sharing a time. Interpolating between samples would smear the steps
+	static bool HasDiscontinuities(const FRichCurve& Curve)
+	{
+		const TArray<FRichCurveKey>& Keys = Curve.GetConstRefOfKeys();
+		for (int32 Index = 0; Index + 1 < Keys.Num(); Index++)
+		{
+			if (Keys[Index].InterpMode == RCIM_Constant || FMath::IsNearlyEqual(Keys[Index].Time, Keys[Index + 1].Time)) return true;
+		}
+		return false;
+	}
+
+	/* Tables of every curve sampled so far, keyed by asset */
+	class FCurveLUTCache
+	{
+	public:
+		static FCurveLUTCache& Get()
+		{
+			static FCurveLUTCache Cache;
+			return Cache;
+		}
+
+		const FBakedCurve& FindOrBake(const UCurveFloat& Curve)
+		{
+			FBakedCurve* Baked = Tables.Find(TObjectKey<UCurveBase>(&Curve));
+			if (!Baked)
+			{
+				Baked = &Tables.Add(TObjectKey<UCurveBase>(&Curve));
+				
+				float MinTime, MaxTime;
+				Curve.GetTimeRange(MinTime, MaxTime);
+				if (HasDiscontinuities(Curve.FloatCurve))
+				{
+					// Left unbaked, only the range is kept for fraction lookups
+					Baked->MinTime = MinTime;
+					Baked->MaxTime = MaxTime;
+					return *Baked;
+				}
+				
+				Bake<1>(*Baked, MinTime, MaxTime, [&Curve](float Time, float* OutValues)
+				{
+					OutValues[0] = Curve.GetFloatValue(Time);
+				});
+			}
+			return *Baked;
+		}
+		
+		const FBakedCurve& FindOrBake(const UCurveVector& Curve)
+		{
+			FBakedCurve* Baked = Tables.Find(TObjectKey<UCurveBase>(&Curve));
+			if (!Baked)
+			{
+				Baked = &Tables.Add(TObjectKey<UCurveBase>(&Curve));
+				
+				float MinTime, MaxTime;
+				Curve.GetTimeRange(MinTime, MaxTime);
+				if (HasDiscontinuities(Curve.FloatCurves[0]) || HasDiscontinuities(Curve.FloatCurves[1]) || HasDiscontinuities(Curve.FloatCurves[2]))
+				{
+					Baked->MinTime = MinTime;
+					Baked->MaxTime = MaxTime;
+					return *Baked;
+				}
+				
+				Bake<3>(*Baked, MinTime, MaxTime, [&Curve](float Time, float* OutValues)
+				{
+					const FVector Value = Curve.GetVectorValue(Time);
+					OutValues[0] = Value.X;
+					OutValues[1] = Value.Y;
+					OutValues[2] = Value.Z;
+				});
+			}
+			return *Baked;
+		}
+
+		void Invalidate(const UCurveBase* Curve)
+		{
+			if (Curve) Tables.Remove(TObjectKey<UCurveBase>(Curve));
+			else Tables.Empty();
+		}
+
+	private:
+		FCurveLUTCache()
+		{
+			// Drop the tables of collected curves
+			FCoreUObjectDelegates::GetPostGarbageCollect().AddLambda([this]()
+			{
+				for (auto It = Tables.CreateIterator(); It; ++It)
+				{
+					if (!It.Key().ResolveObjectPtr()) It.RemoveCurrent();
+				}
+			});
+			
+#if WITH_EDITOR
+			// Rebake curves edited in the curve editor or details panel
+			FCoreUObjectDelegates::OnObjectModified.AddLambda([this](UObject* Object)
+			{
+				if (const UCurveBase* Curve = Cast<UCurveBase>(Object)) Invalidate(Curve);
+			});
+			FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda([this](UObject* Object, FPropertyChangedEvent&)
+			{
+				if (const UCurveBase* Curve = Cast<UCurveBase>(Object)) Invalidate(Curve);
+			});
+#endif
+		}
+
+		TMap<TObjectKey<UCurveBase>, FBakedCurve> Tables;
+	};
+
+	
+	float EvaluateFloat(const UCurveFloat& Curve, float Time)
+	{
+		if (CurveLUTCVars::EnableCurveLUT)
+		{
+			const FBakedCurve& Baked = FCurveLUTCache::Get().FindOrBake(Curve);
+			if (Baked.IsValid() && Baked.IsInRange(Time))
+			{
+				float Value;
+				Baked.Sample(Time, &Value);
+				return Value;
+			}
+		}
+		return Curve.GetFloatValue(Time);
+	}
+
+	FVector EvaluateVector(const UCurveVector& Curve, float Time)
+	{
+		if (CurveLUTCVars::EnableCurveLUT)
+		{
+			const FBakedCurve& Baked = FCurveLUTCache::Get().FindOrBake(Curve);
+			if (Baked.IsValid() && Baked.IsInRange(Time))
+			{
+				float Value[3];
+				Baked.Sample(Time, Value);
+				return FVector(Value[0], Value[1], Value[2]);
+			}
+		}
+		return Curve.GetVectorValue(Time);
+	}
+
+	float EvaluateFloatAtFraction(const UCurveFloat& Curve, float Fraction)
+	{
+		if (CurveLUTCVars::EnableCurveLUT)
+		{
+			const FBakedCurve& Baked = FCurveLUTCache::Get().FindOrBake(Curve);
+			const float Time = FMath::Lerp(Baked.MinTime, Baked.MaxTime, Fraction);
+			if (Baked.IsValid() && Baked.IsInRange(Time))
+			{
+				float Value;
+				Baked.Sample(Time, &Value);
+				return Value;
+			}
+			return Curve.GetFloatValue(Time);
+		}
+		
+		float MinTime, MaxTime;
+		Curve.GetTimeRange(MinTime, MaxTime);
+		return Curve.GetFloatValue(FMath::Lerp(MinTime, MaxTime, Fraction));
+	}
+
+	FVector EvaluateVectorAtFraction(const UCurveVector& Curve, float Fraction)
+	{
+		if (CurveLUTCVars::EnableCurveLUT)
+		{
+			const FBakedCurve& Baked = FCurveLUTCache::Get().FindOrBake(Curve);
+			const float Time = FMath::Lerp(Baked.MinTime, Baked.MaxTime, Fraction);
+			if (Baked.IsValid() && Baked.IsInRange(Time))
+			{
+				float Value[3];
+				Baked.Sample(Time, Value);
+				return FVector(Value[0], Value[1], Value[2]);
+			}
+			return Curve.GetVectorValue(Time);
+		}
+		
+		float MinTime, MaxTime;
+		Curve.GetTimeRange(MinTime, MaxTime);
+		return Curve.GetVectorValue(FMath::Lerp(MinTime, MaxTime, Fraction));
+	}
+
+	void Invalidate(const UCurveBase* Curve)
+	{
+		FCurveLUTCache::Get().Invalidate(Curve);
+	}
+}
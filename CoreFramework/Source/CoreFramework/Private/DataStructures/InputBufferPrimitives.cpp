@@ -7,95 +7,104 @@
 #include "Subsystems/InputBufferSubsystem.h"
 
 
-/* ~~~~~ Buffer Frame ~~~~~ */
+/* ~~~~~ Buffer Frames ~~~~~ */
 
-void FBufferFrame::InitializeFrame(const FGameplayTagContainer& CachedActionIDs)
+void FBufferFrameRing::Initialize(int32 InNumFrames, int32 InNumSlots)
 {
-	InputsFrameState.Empty();
+	FrameCount = FMath::Max(InNumFrames, 0);
+	SlotCount = FMath::Max(InNumSlots, 0);
+	FrontRow = 0;
 	
-	for (auto ID : CachedActionIDs)
-	{
-		FInputFrameState NewFS = FInputFrameState(ID);
-		InputsFrameState.Add(ID, NewFS);
-	}
+	const int32 NumCells = FrameCount * SlotCount;
+	Values.Init(FInputActionValue(), NumCells);
+	HoldTimes.Init(0, NumCells);
+	UsedFlags.Init(false, NumCells);
+	ReleaseFlags.Init(false, NumCells);
 }
 
-void FBufferFrame::UpdateFrameState(const TMap<FGameplayTag, FRawInputValue>& RawValueContainer)
+void FBufferFrameRing::Advance(const TArray<FRawInputValue>& RawValueContainer)
 {
-	for (auto FrameState : InputsFrameState)
-	{
-		InputsFrameState[FrameState.Key].ResolveCommand(RawValueContainer);
-	}
-}
+	if (FrameCount == 0) return;
+	
+	const int32 PrevRow = FrontRow;
+	FrontRow = FrontRow == 0 ? FrameCount - 1 : FrontRow - 1;
 
-void FBufferFrame::CopyFrameState(const FGameplayTagContainer& CachedActionIDs, FBufferFrame& FrameState)
-{
-	for (auto ID : CachedActionIDs)
+	/* Carry the previous front's state into the recycled row */
+	const int32 Dest = FrontRow * SlotCount;
+	if (FrontRow != PrevRow)
 	{
-		InputsFrameState[ID].Value = FrameState.InputsFrameState[ID].Value;
-		InputsFrameState[ID].HoldTime = FrameState.InputsFrameState[ID].HoldTime;
-		InputsFrameState[ID].bUsed = FrameState.InputsFrameState[ID].bUsed;
-		InputsFrameState[ID].bReleaseFlagged = false;
+		const int32 Src = PrevRow * SlotCount;
+		FMemory::Memcpy(&Values[Dest], &Values[Src], SlotCount * sizeof(FInputActionValue));
+		FMemory::Memcpy(&HoldTimes[Dest], &HoldTimes[Src], SlotCount * sizeof(int32));
+		FMemory::Memcpy(&UsedFlags[Dest], &UsedFlags[Src], SlotCount * sizeof(bool));
 	}
-}
+	FMemory::Memzero(&ReleaseFlags[Dest], SlotCount * sizeof(bool));
 
-/* ~~~~~ Input State ~~~~~ */
-
-void FInputFrameState::ResolveCommand(const TMap<FGameplayTag, FRawInputValue>& RawValueContainer)
-{
-	if (RawValueContainer.Contains(ID))
+	const int32 NumResolved = FMath::Min(SlotCount, RawValueContainer.Num());
+	for (int32 Slot = 0; Slot < NumResolved; Slot++)
 	{
-		if (RawValueContainer[ID].IsThereInput())
-		{
-			HoldUp(RawValueContainer[ID].GetValue());
-		}
-		else
-		{
-			//bUsed = false; // NOTE: Let bUsed carry over from previous frames (to invoke valid Holds), it's reset when the input is released (if never consumed that carries over so its fine)
-			ReleaseHold(RawValueContainer[ID].GetValue());
-		}
+		ResolveCommand(Dest + Slot, RawValueContainer[Slot]);
 	}
 }
 
-bool FInputFrameState::CanInvokePress() const
+FInputFrameState FBufferFrameRing::GetFrameState(int32 Frame, int32 Slot) const
 {
-	return (HoldTime == 1 && !bUsed);
+	const int32 Index = Cell(Frame, Slot);
+	
+	FInputFrameState FrameState;
+	FrameState.Value = Values[Index];
+	FrameState.HoldTime = HoldTimes[Index];
+	FrameState.bUsed = UsedFlags[Index];
+	FrameState.bReleaseFlagged = ReleaseFlags[Index];
+	return FrameState;
 }
 
-bool FInputFrameState::CanInvokeHold() const
+void FBufferFrameRing::WriteRows(FInputActionValue* OutValues, int32* OutHoldTimes, bool* OutUsedFlags, bool* OutReleaseFlags, int32& OutFrontRow) const
 {
-	return (HoldTime > 1);// && bUsed); 
+	FMemory::Memcpy(OutValues, Values.GetData(), Values.Num() * sizeof(FInputActionValue));
+	FMemory::Memcpy(OutHoldTimes, HoldTimes.GetData(), HoldTimes.Num() * sizeof(int32));
+	FMemory::Memcpy(OutUsedFlags, UsedFlags.GetData(), UsedFlags.Num() * sizeof(bool));
+	FMemory::Memcpy(OutReleaseFlags, ReleaseFlags.GetData(), ReleaseFlags.Num() * sizeof(bool));
+	OutFrontRow = FrontRow;
 }
 
-bool FInputFrameState::CanInvokeRelease() const
+void FBufferFrameRing::ReadRows(const FInputActionValue* InValues, const int32* InHoldTimes, const bool* InUsedFlags, const bool* InReleaseFlags, int32 InFrontRow)
 {
-	return (HoldTime < 0);// && bUsed);
+	FMemory::Memcpy(Values.GetData(), InValues, Values.Num() * sizeof(FInputActionValue));
+	FMemory::Memcpy(HoldTimes.GetData(), InHoldTimes, HoldTimes.Num() * sizeof(int32));
+	FMemory::Memcpy(UsedFlags.GetData(), InUsedFlags, UsedFlags.Num() * sizeof(bool));
+	FMemory::Memcpy(ReleaseFlags.GetData(), InReleaseFlags, ReleaseFlags.Num() * sizeof(bool));
+	FrontRow = InFrontRow;
 }
 
+/* ~~~~~ Input State ~~~~~ */
 
-void FInputFrameState::HoldUp(const FInputActionValue InValue)
-{
-	Value = InValue;
-
-	if (HoldTime < 0)
-	{
-		HoldTime = 1;
-		bUsed = false;
-	}
-	else HoldTime += 1;
-}
-
-void FInputFrameState::ReleaseHold(const FInputActionValue InValue)
+void FBufferFrameRing::ResolveCommand(int32 Index, const FRawInputValue& RawValue)
 {
-	Value = InValue;
+	Values[Index] = RawValue.GetValue();
 	
-	if (HoldTime > 0)
+	if (RawValue.IsThereInput())
 	{
-		HoldTime = -HoldTime;
+		/* Held */
+		if (HoldTimes[Index] < 0)
+		{
+			HoldTimes[Index] = 1;
+			UsedFlags[Index] = false;
+		}
+		else HoldTimes[Index] += 1;
 	}
 	else
 	{
-		HoldTime = 0;
-		bUsed = false;
+		//bUsed = false; // NOTE: Let bUsed carry over from previous frames (to invoke valid Holds), it's reset when the input is released (if never consumed that carries over so its fine)
+		/* Released or not registered */
+		if (HoldTimes[Index] > 0)
+		{
+			HoldTimes[Index] = -HoldTimes[Index];
+		}
+		else
+		{
+			HoldTimes[Index] = 0;
+			UsedFlags[Index] = false;
+		}
 	}
-}
\ No newline at end of file
+}
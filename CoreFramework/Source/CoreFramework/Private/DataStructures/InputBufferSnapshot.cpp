@@ -0,0 +1,75 @@
+﻿// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#include "InputBufferSnapshot.h"
+
+
+/* ~~~~~ Layout ~~~~~ */
+
+void FInputBufferSnapshotLayout::Compute(const int32 InNumFrames, const int32 InNumSlots, const int32 InNumDirectionals)
+{
+	NumFrames = InNumFrames;
+	NumSlots = InNumSlots;
+	NumDirectionals = InNumDirectionals;
+
+	SIZE_T Offset = 0;
+	const auto AddSection = [&Offset](const SIZE_T SectionSize)
+	{
+		const SIZE_T SectionOffset = Offset;
+		Offset = Align(Offset + SectionSize, 16);
+		return SectionOffset;
+	};
+
+	const SIZE_T NumCells = static_cast<SIZE_T>(NumFrames) * NumSlots;
+	Values = AddSection(NumCells * sizeof(FInputActionValue));
+	HoldTimes = AddSection(NumCells * sizeof(int32));
+	UsedFlags = AddSection(NumCells * sizeof(bool));
+	ReleaseFlags = AddSection(NumCells * sizeof(bool));
+	ValidFrames = AddSection(NumSlots * sizeof(FBufferStateTuple));
+	LastEvaluatedValidFrames = AddSection(NumSlots * sizeof(FBufferStateTuple));
+	FrameTrackers = AddSection(NumSlots * sizeof(FButtonFrameTracker));
+	RawValues = AddSection(NumSlots * sizeof(FRawInputValue));
+	DirectionalValidFrames = AddSection(NumDirectionals * sizeof(int8));
+	DirectionalUnconsumedFrames = AddSection(NumDirectionals * sizeof(uint8));
+	LastEvaluatedDirectionalValidFrames = AddSection(NumDirectionals * sizeof(int8));
+	Scalars = AddSection(sizeof(FInputBufferSnapshotScalars));
+	Size = Offset;
+}
+
+
+/* ~~~~~ Ring ~~~~~ */
+
+void FInputBufferSnapshotRing::Initialize(const FInputBufferSnapshotLayout& InLayout, const int32 NumSnapshots)
+{
+	Layout = InLayout;
+	Storage.SetNumUninitialized(Layout.Size * FMath::Max(0, NumSnapshots));
+	SnapshotFrames.Init(INDEX_NONE, FMath::Max(0, NumSnapshots));
+	NextSnapshot = 0;
+}
+
+uint8* FInputBufferSnapshotRing::Allocate(const int32 Frame)
+{
+	if (!IsInitialized()) return nullptr;
+
+	// Re-saving a frame overwrites its snapshot instead of keeping two of it
+	int32 Snapshot = SnapshotFrames.Find(Frame);
+	if (Snapshot == INDEX_NONE)
+	{
+		Snapshot = NextSnapshot;
+		NextSnapshot = (NextSnapshot + 1) % SnapshotFrames.Num();
+	}
+	
+	SnapshotFrames[Snapshot] = Frame;
+	return Storage.GetData() + Snapshot * Layout.Size;
+}
+
+const uint8* FInputBufferSnapshotRing::Find(const int32 Frame) const
+{
+	const int32 Snapshot = SnapshotFrames.Find(Frame);
+	return Snapshot != INDEX_NONE ? Storage.GetData() + Snapshot * Layout.Size : nullptr;
+}
+
+void FInputBufferSnapshotRing::Invalidate()
+{
+	for (int32& SnapshotFrame : SnapshotFrames) SnapshotFrame = INDEX_NONE;
+	NextSnapshot = 0;
+}
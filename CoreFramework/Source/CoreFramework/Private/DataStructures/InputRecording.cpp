@@ -0,0 +1,150 @@
+﻿// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#include "InputRecording.h"
+
+#include "InputBufferPrimitives.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+
+
+/* ~~~~~ Layout ~~~~~ */
+
+int64 FInputRecordingHeader::GetFileSize() const
+{
+	return GetInputsOffset() + NumInputs * sizeof(FRecordedRawInput);
+}
+
+FRawInputValue FRecordedRawInput::ToRawValue() const
+{
+	const FInputActionValue InputValue(static_cast<EInputActionValueType>(ValueType), FVector(Value[0], Value[1], Value[2]));
+	return FRawInputValue(InputValue, TriggeredTime);
+}
+
+
+/* ~~~~~ Writer ~~~~~ */
+
+void FInputRecordingWriter::Begin(const TArray<FGameplayTag>& SlotActionIDs, const float InTickInterval)
+{
+	SlotNames = SlotActionIDs;
+	TickInterval = InTickInterval;
+	Ticks.Reset();
+	Inputs.Reset();
+	NumUpdates = 0;
+	NumTickUpdates = 0;
+	bRecording = true;
+}
+
+void FInputRecordingWriter::RecordInput(const int32 Slot, const FRawInputValue& RawValue, const double Timestamp)
+{
+	const FVector Value = RawValue.GetValue().Get<FVector>();
+	
+	FRecordedRawInput& Input = Inputs.AddDefaulted_GetRef();
+	Input.Update = NumUpdates;
+	Input.Slot = static_cast<uint16>(Slot);
+	Input.ValueType = static_cast<uint8>(RawValue.GetValueType());
+	Input.Value[0] = Value.X;
+	Input.Value[1] = Value.Y;
+	Input.Value[2] = Value.Z;
+	Input.TriggeredTime = RawValue.GetTriggeredTime();
+	Input.Timestamp = Timestamp;
+}
+
+bool FInputRecordingWriter::End(const FString& FilePath)
+{
+	if (!bRecording) return false;
+	bRecording = false;
+	
+	// Ticks that haven't finished are still recorded so their updates are replayed
+	if (NumTickUpdates > 0) RecordTick();
+
+	TArray<uint8> SlotNameBytes;
+	for (const FGameplayTag& SlotName : SlotNames)
+	{
+		const FTCHARToUTF8 Name(*SlotName.ToString());
+		SlotNameBytes.Append(reinterpret_cast<const uint8*>(Name.Get()), Name.Length());
+		SlotNameBytes.Add(0);
+	}
+	SlotNameBytes.SetNumZeroed(Align(SlotNameBytes.Num(), 8));
+
+	FInputRecordingHeader Header;
+	Header.TickInterval = TickInterval;
+	Header.NumSlots = SlotNames.Num();
+	Header.SlotNamesSize = SlotNameBytes.Num();
+	Header.NumTicks = Ticks.Num();
+	Header.NumInputs = Inputs.Num();
+	Header.NumUpdates = NumUpdates;
+
+	TArray<uint8> FileData;
+	FileData.SetNumZeroed(Header.GetFileSize());
+	FMemory::Memcpy(FileData.GetData(), &Header, sizeof(Header));
+	FMemory::Memcpy(FileData.GetData() + sizeof(Header), SlotNameBytes.GetData(), SlotNameBytes.Num());
+	FMemory::Memcpy(FileData.GetData() + Header.GetTicksOffset(), Ticks.GetData(), Ticks.Num() * sizeof(uint32));
+	FMemory::Memcpy(FileData.GetData() + Header.GetInputsOffset(), Inputs.GetData(), Inputs.Num() * sizeof(FRecordedRawInput));
+	
+	Ticks.Empty();
+	Inputs.Empty();
+	
+	return FFileHelper::SaveArrayToFile(FileData, *FilePath);
+}
+
+
+/* ~~~~~ Reader ~~~~~ */
+
+FInputRecordingReader::FInputRecordingReader() : Data(nullptr) {}
+
+FInputRecordingReader::~FInputRecordingReader()
+{
+	// Region has to be unmapped before its file handle is closed
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+}
+
+bool FInputRecordingReader::Open(const FString& FilePath)
+{
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+	LoadedData.Empty();
+	SlotNames.Reset();
+	Data = nullptr;
+	
+	int64 Size = 0;
+	MappedHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FilePath));
+	if (MappedHandle)
+	{
+		MappedRegion.Reset(MappedHandle->MapRegion());
+	}
+	
+	if (MappedRegion)
+	{
+		Data = MappedRegion->GetMappedPtr();
+		Size = MappedRegion->GetMappedSize();
+	}
+	else
+	{
+		// Platform doesn't support mapping files, read it into memory instead
+		if (!FFileHelper::LoadFileToArray(LoadedData, *FilePath, FILEREAD_Silent)) return false;
+		Data = LoadedData.GetData();
+		Size = LoadedData.Num();
+	}
+
+	if (Size < static_cast<int64>(sizeof(FInputRecordingHeader))) return false;
+	
+	const FInputRecordingHeader& Header = GetHeader();
+	if (Header.Magic != FInputRecordingHeader::MAGIC || Header.Version != FInputRecordingHeader::VERSION) return false;
+	if (Size < Header.GetFileSize()) return false;
+
+	// Slot names are small, they're resolved once so replay can remap recorded slots
+	const ANSICHAR* SlotName = reinterpret_cast<const ANSICHAR*>(Data + sizeof(FInputRecordingHeader));
+	const ANSICHAR* SlotNamesEnd = SlotName + Header.SlotNamesSize;
+	for (uint32 Slot = 0; Slot < Header.NumSlots; Slot++)
+	{
+		const int32 Length = FCStringAnsi::Strnlen(SlotName, SlotNamesEnd - SlotName);
+		if (SlotName + Length >= SlotNamesEnd) return false;
+		
+		SlotNames.Add(FName(FUTF8ToTCHAR(SlotName).Get()));
+		SlotName += Length + 1;
+	}
+	
+	return true;
+}
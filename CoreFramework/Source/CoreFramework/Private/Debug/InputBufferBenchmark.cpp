@@ -0,0 +1,316 @@
+﻿// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#include "Debug/InputBufferBenchmark.h"
+#include "Debug/ThreadAllocationCounter.h"
+
+#include "Subsystems/InputBufferSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/LocalPlayer.h"
+#include "InputData.h"
+#include "InputMappingContext.h"
+#include "InputCoreTypes.h"
+#include "NativeGameplayTags.h"
+#include "HAL/LowLevelMemTracker.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace InputBufferBenchmark
+{
+	/* Tags of the synthetic input map, actions are keyed by tags so the map can only hold as many actions as there are tags */
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Button_0, "Input.Button.Benchmark.0");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Button_1, "Input.Button.Benchmark.1");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Button_2, "Input.Button.Benchmark.2");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Button_3, "Input.Button.Benchmark.3");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Button_4, "Input.Button.Benchmark.4");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Button_5, "Input.Button.Benchmark.5");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Button_6, "Input.Button.Benchmark.6");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Button_7, "Input.Button.Benchmark.7");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Button_8, "Input.Button.Benchmark.8");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Button_9, "Input.Button.Benchmark.9");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Button_10, "Input.Button.Benchmark.10");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Button_11, "Input.Button.Benchmark.11");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Button_12, "Input.Button.Benchmark.12");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Button_13, "Input.Button.Benchmark.13");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Button_14, "Input.Button.Benchmark.14");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Button_15, "Input.Button.Benchmark.15");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Axis, "Input.Axis.Benchmark");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Directional_0, "Input.Directional.Benchmark.0");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Directional_1, "Input.Directional.Benchmark.1");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Directional_2, "Input.Directional.Benchmark.2");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_Directional_3, "Input.Directional.Benchmark.3");
+
+	static const FNativeGameplayTag* const ButtonTags[FInputBufferBenchmark::MaxActions] = { &TAG_Benchmark_Button_0, &TAG_Benchmark_Button_1, &TAG_Benchmark_Button_2, &TAG_Benchmark_Button_3, &TAG_Benchmark_Button_4, &TAG_Benchmark_Button_5, &TAG_Benchmark_Button_6, &TAG_Benchmark_Button_7, &TAG_Benchmark_Button_8, &TAG_Benchmark_Button_9, &TAG_Benchmark_Button_10, &TAG_Benchmark_Button_11, &TAG_Benchmark_Button_12, &TAG_Benchmark_Button_13, &TAG_Benchmark_Button_14, &TAG_Benchmark_Button_15 };
+	static const FNativeGameplayTag* const DirectionalTags[FInputBufferBenchmark::MaxMotionActions] = { &TAG_Benchmark_Directional_0, &TAG_Benchmark_Directional_1, &TAG_Benchmark_Directional_2, &TAG_Benchmark_Directional_3 };
+
+	/* Motion commands of the synthetic directional map, the scripted axis sweeps right to left through forward so each of them is matched */
+	static const TArray<EMotionCommandDirection> MotionSequences[FInputBufferBenchmark::MaxMotionActions] =
+	{
+		{ RIGHT, FORWARD },
+		{ FORWARD, LEFT },
+		{ RIGHT, FORWARD, LEFT },
+		{ LEFT, RIGHT, FORWARD }
+	};
+
+	/// @brief	Per call timings & allocations of a benchmarked function
+	struct FSamples
+	{
+		explicit FSamples(const TCHAR* InName) : Name(InName) {}
+
+		/// @brief	Times a call & counts the allocations this thread made in it. Warm calls are the ones made once the buffer reached its
+		///			steady state, they're expected not to allocate
+		template<typename FuncType>
+		void Measure(const bool bWarm, FuncType&& Func)
+		{
+			FThreadAllocationCounter::Start();
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			Func();
+			const uint64 EndCycles = FPlatformTime::Cycles64();
+			const int64 CallAllocations = FThreadAllocationCounter::Stop();
+
+			Micros.Add(FPlatformTime::ToMilliseconds64(EndCycles - StartCycles) * 1000.0);
+			NumAllocations += CallAllocations;
+			if (bWarm) NumWarmAllocations += CallAllocations;
+		}
+
+		void Report(TArray<FString>& OutReport)
+		{
+			if (Micros.IsEmpty()) return;
+
+			Micros.Sort();
+			double Total = 0.0;
+			for (const double Sample : Micros) Total += Sample;
+			
+			OutReport.Add(FString::Printf(TEXT("%-16s %8d calls | avg %8.3f us | p50 %8.3f us | p90 %8.3f us | p99 %8.3f us | max %8.3f us | %6.2f allocs/call | %lld warm allocs"),
+				Name, Micros.Num(), Total / Micros.Num(), Percentile(0.5), Percentile(0.9), Percentile(0.99), Micros.Last(), static_cast<double>(NumAllocations) / Micros.Num(), NumWarmAllocations));
+		}
+
+		/// @brief	Timing at the given percentile, only valid once the samples are sorted by Report
+		double Percentile(const double P) const
+		{
+			return Micros.IsEmpty() ? 0.0 : Micros[FMath::Min(Micros.Num() - 1, FMath::FloorToInt32(P * Micros.Num()))];
+		}
+
+		const TCHAR* Name;
+		TArray<double> Micros;
+		int64 NumAllocations = 0;
+		int64 NumWarmAllocations = 0;
+	};
+
+	/// @brief	Scripted raw value of an action slot on a given update. Buttons are pressed & released on staggered periods, the
+	///			directional axis sweeps quarter circles so motion commands are matched throughout the run
+	static FInputActionValue GetScriptedValue(const int32 Slot, const EInputActionValueType ValueType, const bool bDirectionalAxis, const int32 Update)
+	{
+		if (bDirectionalAxis)
+		{
+			const float Angle = (Update % 16) * UE_HALF_PI / 8.f;
+			return FInputActionValue(FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)));
+		}
+
+		const int32 Period = 6 + (Slot % 5) * 2;
+		if ((Update + Slot * 3) % Period >= Period / 2) return FInputActionValue(ValueType, FVector::ZeroVector);
+
+		return FInputActionValue(ValueType, FVector(1.f, ValueType == EInputActionValueType::Axis1D ? 0.f : 1.f, 0.f));
+	}
+}
+
+UInputBufferMap* FInputBufferBenchmark::CreateSyntheticInputMap(const int32 NumActions, const int32 NumMotionActions)
+{
+	using namespace InputBufferBenchmark;
+
+	UInputMappingContext* ActionMap = NewObject<UInputMappingContext>(GetTransientPackage());
+	for (int32 Action = 0; Action < NumActions; Action++)
+	{
+		UBufferedInputAction* InputAction = NewObject<UBufferedInputAction>(GetTransientPackage());
+		InputAction->InputTag = ButtonTags[Action]->GetTag();
+		InputAction->ValueType = Action % 2 == 0 ? EInputActionValueType::Boolean : EInputActionValueType::Axis1D;
+		ActionMap->MapKey(InputAction, EKeys::AnyKey);
+	}
+
+	UInputBufferMap* InputMap = NewObject<UInputBufferMap>(GetTransientPackage());
+	InputMap->InputActionMap = ActionMap;
+	
+	if (NumMotionActions > 0)
+	{
+		UBufferedInputAction* AxisAction = NewObject<UBufferedInputAction>(GetTransientPackage());
+		AxisAction->InputTag = TAG_Benchmark_Axis.GetTag();
+		AxisAction->ValueType = EInputActionValueType::Axis2D;
+		ActionMap->MapKey(AxisAction, EKeys::Gamepad_Left2D);
+
+		UMotionMappingContext* DirectionalMap = NewObject<UMotionMappingContext>(GetTransientPackage());
+		DirectionalMap->DirectionalAction = AxisAction;
+		for (int32 Motion = 0; Motion < NumMotionActions; Motion++)
+		{
+			UMotionAction* MotionAction = NewObject<UMotionAction>(GetTransientPackage());
+			MotionAction->InputTag = DirectionalTags[Motion]->GetTag();
+			MotionAction->bAngleChange = false;
+			MotionAction->bRelativeToPlayer = false;
+			for (const EMotionCommandDirection Direction : MotionSequences[Motion])
+			{
+				MotionAction->MotionCommandSequence.Add(Direction);
+			}
+			DirectionalMap->Mapping.Add(MotionAction);
+		}
+		InputMap->DirectionalActionMap = DirectionalMap;
+	}
+
+	InputMap->GenerateInputActions();
+	return InputMap;
+}
+
+bool FInputBufferBenchmark::Run(const FInputBufferBenchmarkSettings& Settings, FInputBufferBenchmarkResults& OutResults)
+{
+	using namespace InputBufferBenchmark;
+	LLM_SCOPE_BYNAME(TEXT("InputBuffer/Benchmark"));
+
+	OutResults = FInputBufferBenchmarkResults();
+	if (Settings.NumUpdates <= 0) return false;
+	
+	/* Synthetic buffer, initialized straight off the input map since it isn't bound to EIC. Local player subsystems can only live
+	   within a local player, so it's given a transient one that's never added to the game instance */
+	ULocalPlayer* LocalPlayer = NewObject<ULocalPlayer>(GEngine);
+	LocalPlayer->AddToRoot();
+	UInputBufferSubsystem* InputBuffer = NewObject<UInputBufferSubsystem>(LocalPlayer);
+	InputBuffer->AddToRoot();
+	InputBuffer->InitializeBufferSettings();
+	if (Settings.BufferSize > 0)
+	{
+		InputBuffer->BUFFER_SIZE = FMath::Clamp<int32>(Settings.BufferSize, InputBuffer->BUTTON_BUFFER_SIZE, MAX_int8); // Frames are indexed by int8
+	}
+	InputBuffer->bTimestampedSampling = false;
+	InputBuffer->InputMap = CreateSyntheticInputMap(FMath::Clamp(Settings.NumActions, 1, MaxActions), FMath::Clamp(Settings.NumMotionActions, 0, MaxMotionActions));
+	InputBuffer->CachedActionIDs = InputBuffer->InputMap->GetActionIDs();
+	InputBuffer->CachedDirectionalActionIDs = InputBuffer->InputMap->GetDirectionalIDs();
+	InputBuffer->InitializeInputBufferData();
+	if (Settings.NumSnapshots > 0) InputBuffer->InitializeSnapshots(Settings.NumSnapshots);
+
+	UInputBufferBenchmarkListener* Listener = NewObject<UInputBufferBenchmarkListener>();
+	Listener->AddToRoot();
+	
+	FSamples BindSamples(TEXT("Bind*"));
+	FSamples UpdateSamples(TEXT("UpdateBuffer"));
+	FSamples EvaluateSamples(TEXT("EvaluateEvents"));
+	FSamples ConsumeSamples(TEXT("ConsumeInput"));
+	FSamples SaveSamples(TEXT("SaveSnapshot"));
+	FSamples RestoreSamples(TEXT("RestoreSnapshot"));
+
+	const TArray<FGameplayTag>& SlotActionIDs = InputBuffer->GetBufferedActionIDs();
+	const int32 NumSlots = SlotActionIDs.Num();
+	TArray<FGameplayTag> DirectionalIDs;
+	InputBuffer->CachedDirectionalActionIDs.GetGameplayTagArray(DirectionalIDs);
+
+	// Value types & the directional axis are resolved once, the scripted values are generated from them every update
+	TArray<EInputActionValueType> SlotValueTypes;
+	SlotValueTypes.Init(EInputActionValueType::Boolean, NumSlots);
+	for (const auto& Action : InputBuffer->InputMap->GetInputActions())
+	{
+		const int32 Slot = InputBuffer->GetActionSlot(Action->GetID());
+		if (Slot != INDEX_NONE) SlotValueTypes[Slot] = Action->ValueType;
+	}
+	const int32 DirectionalAxisSlot = InputBuffer->InputMap->DirectionalActionMap ? InputBuffer->GetActionSlot(InputBuffer->InputMap->DirectionalActionMap->GetDirectionalActionID()) : INDEX_NONE;
+
+	TArray<FButtonBinding> ButtonBindings;
+	TArray<FButtonSequenceBinding> SequenceBindings;
+	TArray<FDirectionalBinding> DirectionalBindings;
+	
+	/* Bind */
+	for (int32 Slot = 0; Slot < NumSlots; Slot++)
+	{
+		for (int32 Binding = 0; Binding < Settings.BindingsPerAction; Binding++)
+		{
+			FButtonBinding& ButtonBinding = ButtonBindings.AddDefaulted_GetRef();
+			ButtonBinding.Delegate.BindUFunction(Listener, GET_FUNCTION_NAME_CHECKED(UInputBufferBenchmarkListener, OnAction));
+
+			const EBufferTriggerEvent Trigger = static_cast<EBufferTriggerEvent>(Binding % 3);
+			BindSamples.Measure(false, [&]() { InputBuffer->BindAction(ButtonBinding, SlotActionIDs[Slot], Trigger, Trigger == TRIGGER_Press && Binding % 2 == 0, Binding); });
+		}
+
+		// Each action is sequenced with the next one
+		FButtonSequenceBinding& SequenceBinding = SequenceBindings.AddDefaulted_GetRef();
+		SequenceBinding.Delegate.BindUFunction(Listener, GET_FUNCTION_NAME_CHECKED(UInputBufferBenchmarkListener, OnActionSequence));
+		BindSamples.Measure(false, [&]() { InputBuffer->BindActionSequence(SequenceBinding, SlotActionIDs[Slot], SlotActionIDs[(Slot + 1) % NumSlots], false, false, true); });
+	}
+
+	for (const FGameplayTag& DirectionalID : DirectionalIDs)
+	{
+		FDirectionalBinding& DirectionalBinding = DirectionalBindings.AddDefaulted_GetRef();
+		DirectionalBinding.Delegate.BindUFunction(Listener, GET_FUNCTION_NAME_CHECKED(UInputBufferBenchmarkListener, OnDirectional));
+		BindSamples.Measure(false, [&]() { InputBuffer->BindDirectionalAction(DirectionalBinding, DirectionalID, false); });
+	}
+
+	/* Drive the buffer. Updates are warm once every row of the ring has been written, and the bindings have been evaluated since */
+	TArray<bool> SlotActive;
+	SlotActive.Init(false, NumSlots);
+	const int32 NumWarmupUpdates = InputBuffer->BUFFER_SIZE + 1;
+	for (int32 Update = 0; Update < Settings.NumUpdates; Update++)
+	{
+		const bool bWarm = Update >= NumWarmupUpdates;
+		
+		// Held inputs are registered every update (EIC triggers every frame), released inputs once with a zero value (completed)
+		for (int32 Slot = 0; Slot < NumSlots; Slot++)
+		{
+			const FInputActionValue Value = GetScriptedValue(Slot, SlotValueTypes[Slot], Slot == DirectionalAxisSlot, Update);
+			if (!Value.IsNonZero() && !SlotActive[Slot]) continue;
+			
+			SlotActive[Slot] = Value.IsNonZero();
+			InputBuffer->RegisterRawInput(FRawInputValue(Value, Update * InputBuffer->TICK_INTERVAL), Slot);
+		}
+		
+		UpdateSamples.Measure(bWarm, [InputBuffer]() { InputBuffer->UpdateBuffer(); });
+		EvaluateSamples.Measure(bWarm, [InputBuffer]() { InputBuffer->EvaluateEvents(); });
+
+		if (Settings.ConsumeInterval > 0 && NumSlots > 0 && Update % Settings.ConsumeInterval == 0)
+		{
+			const FGameplayTag& ConsumedID = SlotActionIDs[(Update / Settings.ConsumeInterval) % NumSlots];
+			ConsumeSamples.Measure(bWarm, [InputBuffer, &ConsumedID]() { InputBuffer->ConsumeInput(ConsumedID); });
+		}
+
+		// Rolls back to an older update, the following updates carry on from the restored state as a re-simulation would
+		if (Settings.NumSnapshots > 0)
+		{
+			SaveSamples.Measure(bWarm, [InputBuffer, Update]() { InputBuffer->SaveSnapshot(Update); });
+			
+			const int32 RollbackFrame = Update - Settings.NumSnapshots / 2;
+			if (Settings.RollbackInterval > 0 && Update % Settings.RollbackInterval == 0 && RollbackFrame >= 0)
+			{
+				RestoreSamples.Measure(bWarm, [InputBuffer, RollbackFrame]() { InputBuffer->RestoreSnapshot(RollbackFrame); });
+			}
+		}
+	}
+
+	OutResults.NumUpdates = Settings.NumUpdates;
+	OutResults.NumActions = NumSlots;
+	OutResults.NumMotionActions = DirectionalIDs.Num();
+	OutResults.BufferSize = InputBuffer->BUFFER_SIZE;
+	OutResults.NumBindings = ButtonBindings.Num() + SequenceBindings.Num() + DirectionalBindings.Num();
+	OutResults.NumEvents = Listener->NumEvents;
+	OutResults.NumWarmUpdates = FMath::Max(0, Settings.NumUpdates - NumWarmupUpdates);
+	OutResults.WarmUpdateAllocations = UpdateSamples.NumWarmAllocations;
+	OutResults.WarmEvaluateAllocations = EvaluateSamples.NumWarmAllocations;
+	BindSamples.Report(OutResults.Report);
+	UpdateSamples.Report(OutResults.Report);
+	EvaluateSamples.Report(OutResults.Report);
+	ConsumeSamples.Report(OutResults.Report);
+	SaveSamples.Report(OutResults.Report);
+	RestoreSamples.Report(OutResults.Report);
+	OutResults.SnapshotSize = Settings.NumSnapshots > 0 ? InputBuffer->GetSnapshotSize() : 0;
+	OutResults.SaveSnapshotMedianMicros = SaveSamples.Percentile(0.5);
+	OutResults.RestoreSnapshotMedianMicros = RestoreSamples.Percentile(0.5);
+
+	/* The synthetic buffer stops ticking once uninitialized and is left to GC */
+	InputBuffer->bInitialized = false;
+	InputBuffer->RemoveFromRoot();
+	LocalPlayer->RemoveFromRoot();
+	Listener->RemoveFromRoot();
+	
+	return true;
+}
+
+#else
+
+bool FInputBufferBenchmark::Run(const FInputBufferBenchmarkSettings& Settings, FInputBufferBenchmarkResults& OutResults)
+{
+	return false;
+}
+
+#endif
+
@@ -0,0 +1,91 @@
+﻿// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputActionValue.h"
+#include "UObject/Object.h"
+#include "InputBufferBenchmark.generated.h"
+
+class UInputBufferMap;
+
+/// @brief	Settings of a benchmark run, the synthetic input map is built off of them (see the ib.Benchmark.* cvars)
+struct FInputBufferBenchmarkSettings
+{
+	/// @brief	Number of buffer updates driven, events are evaluated after each of them
+	int32 NumUpdates = 10000;
+	/// @brief	Button actions of the synthetic input map, capped to FInputBufferBenchmark::MaxActions
+	int32 NumActions = 8;
+	/// @brief	Motion actions of the synthetic directional map, capped to FInputBufferBenchmark::MaxMotionActions. 0 skips the directional map
+	int32 NumMotionActions = 4;
+	/// @brief	Action bindings bound to each buffered action (triggers cycle through press, hold & release)
+	int32 BindingsPerAction = 4;
+	/// @brief	Buffer size to run with, 0 keeps the project's buffer size
+	int32 BufferSize = 0;
+	/// @brief	An input is consumed every (ConsumeInterval) updates, 0 disables consuming
+	int32 ConsumeInterval = 4;
+	/// @brief	Snapshots in the rollback ring, the buffer state is saved after every update. 0 disables snapshots
+	int32 NumSnapshots = 8;
+	/// @brief	The state of (NumSnapshots / 2) updates ago is restored every (RollbackInterval) updates, 0 never restores
+	int32 RollbackInterval = 8;
+};
+
+/// @brief	Outcome of a benchmark run
+struct FInputBufferBenchmarkResults
+{
+	int32 NumUpdates = 0;
+	int32 NumActions = 0;
+	int32 NumMotionActions = 0;
+	int32 BufferSize = 0;
+	int32 NumBindings = 0;
+	int32 NumEvents = 0;
+
+	/// @brief	Updates made once the buffer reached its steady state (every row of the ring written & bindings evaluated since)
+	int32 NumWarmUpdates = 0;
+	/// @brief	Allocations the benchmark thread made in UpdateBuffer & EvaluateEvents over the warm updates, expected to be 0
+	int64 WarmUpdateAllocations = 0;
+	int64 WarmEvaluateAllocations = 0;
+
+	/// @brief	Size in bytes of a single snapshot & median timings of SaveSnapshot & RestoreSnapshot, 0 if snapshots were disabled
+	int32 SnapshotSize = 0;
+	double SaveSnapshotMedianMicros = 0.0;
+	double RestoreSnapshotMedianMicros = 0.0;
+
+	/// @brief	Timings & allocations of each benchmarked function, one line per function
+	TArray<FString> Report;
+};
+
+/// @brief	Target of the benchmark's bindings, only counts the events it receives
+UCLASS(Transient)
+class UInputBufferBenchmarkListener : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION()
+	void OnAction(const FInputActionValue& Value, float ElapsedTime) { NumEvents++; }
+
+	UFUNCTION()
+	void OnActionSequence(const FInputActionValue& ValueOne, const FInputActionValue& ValueTwo) { NumEvents++; }
+
+	UFUNCTION()
+	void OnDirectional() { NumEvents++; }
+
+	int32 NumEvents = 0;
+};
+
+/// @brief	Builds a synthetic input buffer (input map, directional map & bindings sized by the settings) and drives it with scripted input,
+///			timing UpdateBuffer, EvaluateEvents, ConsumeInput, the snapshot calls and the Bind* calls & counting the allocations they make on the benchmark thread. The buffer isn't tied to
+///			a local player or EIC, so it doesn't touch the game's buffer. Run by the CoreFramework.InputBuffer.Benchmark automation test.
+struct FInputBufferBenchmark
+{
+	/// @brief	Actions are keyed by native tags defined for the benchmark (Input.Button.Benchmark.N & Input.Directional.Benchmark.N)
+	static constexpr int32 MaxActions = 16;
+	static constexpr int32 MaxMotionActions = 4;
+	
+	static bool Run(const FInputBufferBenchmarkSettings& Settings, FInputBufferBenchmarkResults& OutResults);
+
+	/// @brief	Input map of NumActions buttons (alternating boolean & 1D axis actions), and a directional map of NumMotionActions motion actions.
+	///			Fills the assets' protected members directly, which is why it's a member of the benchmark (the input assets befriend it)
+	static UInputBufferMap* CreateSyntheticInputMap(const int32 NumActions, const int32 NumMotionActions);
+};
@@ -0,0 +1,244 @@
+// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#include "Debug/MovementQueryStats.h"
+
+#include "RadicalMovementComponent.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Trace/Trace.inl"
+#include "UObject/UObjectIterator.h"
+
+#pragma region Profiling & Trace
+/* Summed over every component each frame, "stat RadicalMovementQueries" */
+DECLARE_STATS_GROUP(TEXT("RadicalMovementComponent_Queries"), STATGROUP_RadicalMovementQueries, STATCAT_Advanced)
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Total Queries"), STAT_QueriesTotal, STATGROUP_RadicalMovementQueries)
+
+/* By Type */
+DECLARE_DWORD_COUNTER_STAT(TEXT("Sweeps"), STAT_QueriesSweeps, STATGROUP_RadicalMovementQueries)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Line Traces"), STAT_QueriesLineTraces, STATGROUP_RadicalMovementQueries)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Overlaps"), STAT_QueriesOverlaps, STATGROUP_RadicalMovementQueries)
+
+/* By Site */
+DECLARE_DWORD_COUNTER_STAT(TEXT("Site: Move"), STAT_QueriesMove, STATGROUP_RadicalMovementQueries)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Site: Floor"), STAT_QueriesFloor, STATGROUP_RadicalMovementQueries)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Site: Perch"), STAT_QueriesPerch, STATGROUP_RadicalMovementQueries)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Site: Step Up"), STAT_QueriesStepUp, STATGROUP_RadicalMovementQueries)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Site: Slide Along Surface"), STAT_QueriesSlideAlongSurface, STATGROUP_RadicalMovementQueries)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Site: Ledge Check"), STAT_QueriesLedgeCheck, STATGROUP_RadicalMovementQueries)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Site: Crouch"), STAT_QueriesCrouch, STATGROUP_RadicalMovementQueries)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Site: Repulsion"), STAT_QueriesRepulsion, STATGROUP_RadicalMovementQueries)
+
+/* Per component per update, enable with -trace=RMCQueries */
+UE_TRACE_CHANNEL_DEFINE(RMCQueriesChannel)
+
+UE_TRACE_EVENT_BEGIN(RadicalMovement, SceneQueries)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, ComponentId)
+	UE_TRACE_EVENT_FIELD(uint32[], Counts)		// Site major, FMovementQueryCounts::Counts
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ActorName)
+UE_TRACE_EVENT_END()
+#pragma endregion Profiling & Trace
+
+
+uint32 FMovementQueryCounts::GetSiteTotal(EMovementQuerySite Site) const
+{
+	uint32 Total = 0;
+	for (int32 Type = 0; Type < NumTypes; Type++)
+	{
+		Total += Counts[static_cast<int32>(Site)][Type];
+	}
+	return Total;
+}
+
+uint32 FMovementQueryCounts::GetTypeTotal(EMovementQueryType Type) const
+{
+	uint32 Total = 0;
+	for (int32 Site = 0; Site < NumSites; Site++)
+	{
+		Total += Counts[Site][static_cast<int32>(Type)];
+	}
+	return Total;
+}
+
+uint32 FMovementQueryCounts::GetTotal() const
+{
+	uint32 Total = 0;
+	for (int32 Site = 0; Site < NumSites; Site++)
+	{
+		Total += GetSiteTotal(static_cast<EMovementQuerySite>(Site));
+	}
+	return Total;
+}
+
+FMovementQueryCounts& FMovementQueryCounts::operator+=(const FMovementQueryCounts& Other)
+{
+	for (int32 Site = 0; Site < NumSites; Site++)
+	{
+		for (int32 Type = 0; Type < NumTypes; Type++)
+		{
+			Counts[Site][Type] += Other.Counts[Site][Type];
+		}
+	}
+	return *this;
+}
+
+const TCHAR* FMovementQueryCounts::GetSiteName(EMovementQuerySite Site)
+{
+	switch (Site)
+	{
+		case EMovementQuerySite::Move:				return TEXT("Move");
+		case EMovementQuerySite::Floor:				return TEXT("Floor");
+		case EMovementQuerySite::Perch:				return TEXT("Perch");
+		case EMovementQuerySite::StepUp:			return TEXT("StepUp");
+		case EMovementQuerySite::SlideAlongSurface:	return TEXT("SlideAlongSurface");
+		case EMovementQuerySite::LedgeCheck:		return TEXT("LedgeCheck");
+		case EMovementQuerySite::Crouch:			return TEXT("Crouch");
+		case EMovementQuerySite::Repulsion:			return TEXT("Repulsion");
+		default:									return TEXT("Invalid");
+	}
+}
+
+const TCHAR* FMovementQueryCounts::GetTypeName(EMovementQueryType Type)
+{
+	switch (Type)
+	{
+		case EMovementQueryType::Sweep:		return TEXT("Sweeps");
+		case EMovementQueryType::LineTrace:	return TEXT("LineTraces");
+		case EMovementQueryType::Overlap:	return TEXT("Overlaps");
+		default:							return TEXT("Invalid");
+	}
+}
+
+
+void MovementQueryStats::ReportUpdate(const URadicalMovementComponent& Component, const FMovementQueryCounts& Counts)
+{
+#if STATS
+	static const FName SiteStats[FMovementQueryCounts::NumSites] =
+	{
+		GET_STATFNAME(STAT_QueriesMove),
+		GET_STATFNAME(STAT_QueriesFloor),
+		GET_STATFNAME(STAT_QueriesPerch),
+		GET_STATFNAME(STAT_QueriesStepUp),
+		GET_STATFNAME(STAT_QueriesSlideAlongSurface),
+		GET_STATFNAME(STAT_QueriesLedgeCheck),
+		GET_STATFNAME(STAT_QueriesCrouch),
+		GET_STATFNAME(STAT_QueriesRepulsion)
+	};
+	static const FName TypeStats[FMovementQueryCounts::NumTypes] =
+	{
+		GET_STATFNAME(STAT_QueriesSweeps),
+		GET_STATFNAME(STAT_QueriesLineTraces),
+		GET_STATFNAME(STAT_QueriesOverlaps)
+	};
+
+	for (int32 Site = 0; Site < FMovementQueryCounts::NumSites; Site++)
+	{
+		INC_DWORD_STAT_FNAME_BY(SiteStats[Site], Counts.GetSiteTotal(static_cast<EMovementQuerySite>(Site)));
+	}
+	for (int32 Type = 0; Type < FMovementQueryCounts::NumTypes; Type++)
+	{
+		INC_DWORD_STAT_FNAME_BY(TypeStats[Type], Counts.GetTypeTotal(static_cast<EMovementQueryType>(Type)));
+	}
+	INC_DWORD_STAT_BY(STAT_QueriesTotal, Counts.GetTotal());
+#endif
+
+#if UE_TRACE_ENABLED
+	if (UE_TRACE_CHANNELEXPR_IS_ENABLED(RMCQueriesChannel))
+	{
+		const FString ActorName = GetNameSafe(Component.GetOwner());
+		UE_TRACE_LOG(RadicalMovement, SceneQueries, RMCQueriesChannel)
+			<< SceneQueries.Cycle(FPlatformTime::Cycles64())
+			<< SceneQueries.ComponentId(reinterpret_cast<UPTRINT>(&Component))
+			<< SceneQueries.Counts(&Counts.Counts[0][0], FMovementQueryCounts::NumSites * FMovementQueryCounts::NumTypes)
+			<< SceneQueries.ActorName(*ActorName, ActorName.Len());
+	}
+#endif
+}
+
+
+#if RMC_QUERY_STATS
+
+namespace MovementQueryStats
+{
+	/// @brief	One row per component, sorted by the average number of queries per update so the characters over budget come first
+	static FString BuildQueryStatsCSV(const UWorld* World)
+	{
+		TArray<const URadicalMovementComponent*> Components;
+		for (TObjectIterator<URadicalMovementComponent> It; It; ++It)
+		{
+			if (It->GetWorld() == World && It->GetNumQueryUpdates() > 0)
+			{
+				Components.Add(*It);
+			}
+		}
+		Components.Sort([](const URadicalMovementComponent& A, const URadicalMovementComponent& B)
+		{
+			return A.GetTotalQueryCounts().GetTotal() / static_cast<float>(A.GetNumQueryUpdates()) > B.GetTotalQueryCounts().GetTotal() / static_cast<float>(B.GetNumQueryUpdates());
+		});
+
+		FString CSV = TEXT("Actor,Component,Updates,AvgPerUpdate,LastUpdate,Total");
+		for (int32 Site = 0; Site < FMovementQueryCounts::NumSites; Site++)
+		{
+			for (int32 Type = 0; Type < FMovementQueryCounts::NumTypes; Type++)
+			{
+				CSV += FString::Printf(TEXT(",%s.%s"),
+					FMovementQueryCounts::GetSiteName(static_cast<EMovementQuerySite>(Site)), FMovementQueryCounts::GetTypeName(static_cast<EMovementQueryType>(Type)));
+			}
+		}
+		CSV += LINE_TERMINATOR;
+
+		for (const URadicalMovementComponent* Component : Components)
+		{
+			const FMovementQueryCounts& Totals = Component->GetTotalQueryCounts();
+			const uint32 NumUpdates = Component->GetNumQueryUpdates();
+
+			CSV += FString::Printf(TEXT("%s,%s,%u,%.2f,%u,%u"), *GetNameSafe(Component->GetOwner()), *Component->GetName(), NumUpdates,
+				Totals.GetTotal() / static_cast<float>(NumUpdates), Component->GetLastUpdateQueryCounts().GetTotal(), Totals.GetTotal());
+			for (int32 Site = 0; Site < FMovementQueryCounts::NumSites; Site++)
+			{
+				for (int32 Type = 0; Type < FMovementQueryCounts::NumTypes; Type++)
+				{
+					CSV += FString::Printf(TEXT(",%u"), Totals.Counts[Site][Type]);
+				}
+			}
+			CSV += LINE_TERMINATOR;
+		}
+
+		return CSV;
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice CmdDumpQueryStats
+	(
+		TEXT("rmc.DumpQueryStats"),
+		TEXT("Writes the scene queries issued by each movement component since the last reset to a CSV. Args: [FilePath] (Defaults to Saved/Profiling/RMCQueries/RMCQueries-<Time>.csv)"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			const FString FilePath = Args.Num() > 0 ? Args[0] : FPaths::ProfilingDir() / TEXT("RMCQueries") / FString::Printf(TEXT("RMCQueries-%s.csv"), *FDateTime::Now().ToString());
+			if (FFileHelper::SaveStringToFile(BuildQueryStatsCSV(World), *FilePath))
+			{
+				Ar.Logf(TEXT("Wrote movement query stats to %s"), *IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*FilePath));
+			}
+			else
+			{
+				Ar.Logf(TEXT("Failed to write movement query stats to %s"), *FilePath);
+			}
+		})
+	);
+
+	FAutoConsoleCommandWithWorldAndArgs CmdResetQueryStats
+	(
+		TEXT("rmc.ResetQueryStats"),
+		TEXT("Resets the scene query counts of every movement component"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			for (TObjectIterator<URadicalMovementComponent> It; It; ++It)
+			{
+				if (It->GetWorld() == World) It->ResetSceneQueryCounts();
+			}
+		})
+	);
+}
+
+#endif
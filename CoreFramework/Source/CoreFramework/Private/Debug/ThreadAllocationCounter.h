@@ -0,0 +1,80 @@
+﻿// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/MemoryBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/// @brief	Counts the heap allocations made by the calling thread. While counting, GMalloc is routed through this proxy which forwards
+///			every call to the allocator it replaced, so other threads keep allocating through it uncounted. The proxy is never destroyed,
+///			a thread that picked it up right before GMalloc was restored still forwards through a live object.
+///			Used by the benchmarks & allocation tests to assert steady state code paths don't allocate.
+class FThreadAllocationCounter final : public FMalloc
+{
+public:
+	/// @brief	Starts counting the calling thread's allocations. Counting doesn't nest
+	static void Start()
+	{
+		FThreadAllocationCounter& Counter = Get();
+		check(!Counter.bCounting);
+
+		Counter.Inner = GMalloc;
+		Counter.NumAllocations = 0;
+		Counter.CountingThreadId = FPlatformTLS::GetCurrentThreadId();
+		Counter.bCounting = true;
+		GMalloc = &Counter;
+	}
+
+	/// @brief	Stops counting and restores the allocator, returns the Malloc & Realloc calls the thread made since Start
+	static int64 Stop()
+	{
+		FThreadAllocationCounter& Counter = Get();
+		check(Counter.bCounting && Counter.CountingThreadId == FPlatformTLS::GetCurrentThreadId());
+
+		GMalloc = Counter.Inner;
+		Counter.bCounting = false;
+		return Counter.NumAllocations;
+	}
+
+#pragma region FMalloc Interface
+
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override { Track(); return Inner->Malloc(Count, Alignment); }
+	virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override { Track(); return Inner->TryMalloc(Count, Alignment); }
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override { if (Count > 0) Track(); return Inner->Realloc(Original, Count, Alignment); }
+	virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override { if (Count > 0) Track(); return Inner->TryRealloc(Original, Count, Alignment); }
+	virtual void Free(void* Original) override { Inner->Free(Original); }
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+	virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+	virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+	virtual void UpdateStats() override { Inner->UpdateStats(); }
+	virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+	virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+	virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+	virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+	virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+#pragma endregion
+
+private:
+	static FThreadAllocationCounter& Get()
+	{
+		static FThreadAllocationCounter Counter;
+		return Counter;
+	}
+
+	FORCEINLINE void Track()
+	{
+		if (bCounting && CountingThreadId == FPlatformTLS::GetCurrentThreadId()) NumAllocations++;
+	}
+
+	FMalloc* Inner = nullptr;
+	std::atomic<bool> bCounting = false;
+	uint32 CountingThreadId = 0;
+	int64 NumAllocations = 0;
+};
+
+#endif
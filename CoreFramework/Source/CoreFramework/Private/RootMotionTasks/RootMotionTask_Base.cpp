@@ -6,6 +6,12 @@
 #include "RadicalMovementComponent.h"
 #include "RadicalCharacter.h"
 
+URootMotionTask_Base* FRootMotionTaskHandle::Get() const
+{
+	URootMotionTask_Base* TaskPtr = Task.Get();
+	return TaskPtr && !TaskPtr->IsPooled() && TaskPtr->GetGeneration() == Generation ? TaskPtr : nullptr;
+}
+
 URootMotionTask_Base::URootMotionTask_Base()
 	: Super()
 {
@@ -57,7 +63,6 @@ void URootMotionTask_Base::PerformActivation()
 void URootMotionTask_Base::InitTask(ARadicalCharacter* InTaskOwner)
 {
 	CharacterOwner = InTaskOwner;
-	UE_LOG(LogTemp, Error, TEXT("Character Owner = %s"), *CharacterOwner->GetName())
 }
 
 AActor* URootMotionTask_Base::GetAvatarActor() const
@@ -70,6 +75,43 @@ AActor* URootMotionTask_Base::GetAvatarActor() const
 	return nullptr;
 }
 
+void URootMotionTask_Base::OnDestroy()
+{
+	if (bPooled) return;
+
+	// The removed source can linger in the group until it's cleaned up, make sure it can't reach the task once it's recycled
+	if (MovementComponent)
+	{
+		if (const TSharedPtr<FRootMotionSourceCFW> RMS = MovementComponent->GetRootMotionSourceByID(RootMotionSourceID))
+		{
+			RMS->AssociatedTask = nullptr;
+		}
+	}
+
+	if (ARadicalCharacter* Character = CharacterOwner.Get())
+	{
+		Character->ReleaseRootMotionTask(this);
+	}
+	else
+	{
+		MarkAsGarbage();
+	}
+}
+
+void URootMotionTask_Base::ResetTask()
+{
+	ForceName = NAME_None;
+	FinishVelocityMode = ERootMotionFinishVelocityMode::MaintainLastRootMotionVelocity;
+	FinishSetVelocity = FVector::ZeroVector;
+	FinishClampVelocity = 0.0f;
+	MovementComponent = nullptr;
+	RootMotionSourceID = (uint16)ERootMotionSourceID::Invalid;
+	bIsFinished = false;
+	StartTime = 0.0f;
+	EndTime = 0.0f;
+	LastFrameNumberWeTicked = INDEX_NONE;
+}
+
 bool URootMotionTask_Base::HasTimedOut() const
 {
 	const TSharedPtr<FRootMotionSourceCFW> RMS = (MovementComponent ? MovementComponent->GetRootMotionSourceByID(RootMotionSourceID) : nullptr);
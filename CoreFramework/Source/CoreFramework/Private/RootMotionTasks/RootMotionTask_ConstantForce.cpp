@@ -63,6 +63,14 @@ void URootMotionTask_ConstantForce::TickTask(float DeltaTime)
 }
 
 
+void URootMotionTask_ConstantForce::ResetTask()
+{
+	Super::ResetTask();
+	
+	OnFinish.Clear();
+	StrengthOverTime = nullptr;
+}
+
 void URootMotionTask_ConstantForce::OnDestroy()
 {
 	if (MovementComponent)
@@ -84,7 +92,7 @@ void URootMotionTask_ConstantForce::SharedInitAndApply()
 		if (MovementComponent)
 		{
 			ForceName = ForceName.IsNone() ? FName("AbilityTaskApplyRootMotionConstantForce"): ForceName;
-			TSharedPtr<FRootMotionSourceCFW_ConstantForce> ConstantForce = MakeShared<FRootMotionSourceCFW_ConstantForce>();
+			TSharedPtr<FRootMotionSourceCFW_ConstantForce> ConstantForce = MovementComponent->NewRootMotionSource<FRootMotionSourceCFW_ConstantForce>();
 			ConstantForce->InstanceName = ForceName;
 			ConstantForce->AccumulateMode = bIsAdditive ? ERootMotionAccumulateMode::Additive : ERootMotionAccumulateMode::Override;
 			ConstantForce->Priority = 5;
@@ -128,6 +128,17 @@ void URootMotionTask_JumpForce::OnDestroy()
 	Super::OnDestroy();
 }
 
+void URootMotionTask_JumpForce::ResetTask()
+{
+	Super::ResetTask();
+	
+	OnFinish.Clear();
+	OnLanded.Clear();
+	PathOffsetCurve = nullptr;
+	TimeMappingCurve = nullptr;
+	bHasLanded = false;
+}
+
 void URootMotionTask_JumpForce::SharedInitAndApply()
 {
 	if (CharacterOwner.Get() && IsValid(CharacterOwner->GetMovementComponent()))
@@ -139,7 +150,7 @@ void URootMotionTask_JumpForce::SharedInitAndApply()
 		if (MovementComponent)
 		{
 			ForceName = ForceName.IsNone() ? FName("AbilityTaskApplyRootMotionJumpForce") : ForceName;
-			TSharedPtr<FRootMotionSourceCFW_JumpForce> JumpForce = MakeShared<FRootMotionSourceCFW_JumpForce>();
+			TSharedPtr<FRootMotionSourceCFW_JumpForce> JumpForce = MovementComponent->NewRootMotionSource<FRootMotionSourceCFW_JumpForce>();
 			JumpForce->InstanceName = ForceName;
 			JumpForce->AccumulateMode = ERootMotionAccumulateMode::Override;
 			JumpForce->Priority = 500;
@@ -129,6 +129,18 @@ void URootMotionTask_MoveToActorForce::TickTask(float DeltaTime)
 
 }
 
+void URootMotionTask_MoveToActorForce::ResetTask()
+{
+	Super::ResetTask();
+	
+	OnFinished.Clear();
+	TargetActor = nullptr;
+	PathOffsetCurve = nullptr;
+	TimeMappingCurve = nullptr;
+	TargetLerpSpeedHorizontalCurve = nullptr;
+	TargetLerpSpeedVerticalCurve = nullptr;
+}
+
 void URootMotionTask_MoveToActorForce::OnDestroy()
 {
 	if (MovementComponent)
@@ -167,7 +179,7 @@ void URootMotionTask_MoveToActorForce::SharedInitAndApply()
 			}
 
 			ForceName = ForceName.IsNone() ? FName("AbilityTaskApplyRootMotionMoveToActorForce") : ForceName;
-			TSharedPtr<FRootMotionSourceCFW_MoveToDynamicForce> MoveToActorForce = MakeShared<FRootMotionSourceCFW_MoveToDynamicForce>();
+			TSharedPtr<FRootMotionSourceCFW_MoveToDynamicForce> MoveToActorForce = MovementComponent->NewRootMotionSource<FRootMotionSourceCFW_MoveToDynamicForce>();
 			MoveToActorForce->InstanceName = ForceName;
 			MoveToActorForce->AccumulateMode = ERootMotionAccumulateMode::Override;
 			MoveToActorForce->Settings.SetFlag(ERootMotionSourceSettingsFlags::UseSensitiveLiftoffCheck);
@@ -78,6 +78,15 @@ void URootMotionTask_MoveToForce::TickTask(float DeltaTime)
 	}
 }
 
+void URootMotionTask_MoveToForce::ResetTask()
+{
+	Super::ResetTask();
+	
+	OnTimedOut.Clear();
+	OnTimedOutAndDestinationReached.Clear();
+	PathOffsetCurve = nullptr;
+}
+
 void URootMotionTask_MoveToForce::OnDestroy()
 {
 	if (MovementComponent)
@@ -110,7 +119,7 @@ void URootMotionTask_MoveToForce::SharedInitAndApply()
 			}
 
 			ForceName = ForceName.IsNone() ? FName("AbilityTaskApplyRootMotionMoveToForce") : ForceName;
-			TSharedPtr<FRootMotionSourceCFW_MoveToForce> MoveToForce = MakeShared<FRootMotionSourceCFW_MoveToForce>();
+			TSharedPtr<FRootMotionSourceCFW_MoveToForce> MoveToForce = MovementComponent->NewRootMotionSource<FRootMotionSourceCFW_MoveToForce>();
 			MoveToForce->InstanceName = ForceName;
 			MoveToForce->AccumulateMode = ERootMotionAccumulateMode::Override;
 			MoveToForce->Settings.SetFlag(ERootMotionSourceSettingsFlags::UseSensitiveLiftoffCheck);
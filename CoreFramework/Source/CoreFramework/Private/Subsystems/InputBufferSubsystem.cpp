@@ -6,33 +6,115 @@
 #include "Helpers/CoreFrameworkStatics.h"
 #include "StaticLibraries/CoreMathLibrary.h"
 #include "CoreFrameworkTags.h"
+#include "Engine/Engine.h"
+#include "Engine/LocalPlayer.h"
+#include "Misc/Paths.h"
 
 DECLARE_CYCLE_STAT(TEXT("Update Buffer"), STAT_UpdateBuffer, STATGROUP_InputBuffer)
 DECLARE_CYCLE_STAT(TEXT("Eval Events"), STAT_EvalEvents, STATGROUP_InputBuffer)
+DECLARE_CYCLE_STAT(TEXT("Replay Recording"), STAT_ReplayRecording, STATGROUP_InputBuffer)
+DECLARE_CYCLE_STAT(TEXT("Save Snapshot"), STAT_SaveSnapshot, STATGROUP_InputBuffer)
+DECLARE_CYCLE_STAT(TEXT("Restore Snapshot"), STAT_RestoreSnapshot, STATGROUP_InputBuffer)
 
 DEFINE_LOG_CATEGORY(LogInputBuffer)
 
+namespace InputBufferCVars
+{
+	int32 IncrementalValidFrames = 1;
+	FAutoConsoleVariableRef CVarIncrementalValidFrames
+	(
+		TEXT("ib.IncrementalValidFrames"),
+		IncrementalValidFrames,
+		TEXT("Resolve button valid frames from incrementally tracked windows instead of rescanning the window every buffer update (only for windows <= 64 frames). 0: Disable, 1: Enable"),
+		ECVF_Default
+	);
+
+#if DO_CHECK
+	int32 ValidateIncrementalValidFrames = 0;
+	FAutoConsoleVariableRef CVarValidateIncrementalValidFrames
+	(
+		TEXT("ib.ValidateIncrementalValidFrames"),
+		ValidateIncrementalValidFrames,
+		TEXT("Cross-check incrementally resolved button valid frames against a full window rescan. 0: Disable, 1: Enable"),
+		ECVF_Default
+	);
+#endif
+
+	static UInputBufferSubsystem* GetFirstPlayerBuffer(const UWorld* World)
+	{
+		const ULocalPlayer* LocalPlayer = GEngine ? GEngine->GetFirstGamePlayer(World) : nullptr;
+		return LocalPlayer ? LocalPlayer->GetSubsystem<UInputBufferSubsystem>() : nullptr;
+	}
+
+	static FString GetRecordingPath(const TArray<FString>& Args)
+	{
+		return Args.Num() > 0 ? Args[0] : FPaths::ProfilingDir() / TEXT("InputRecordings") / TEXT("InputRecording.ibrec");
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs CmdStartRecording
+	(
+		TEXT("ib.Recording.Start"),
+		TEXT("Starts recording the raw input of the first local player's input buffer"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UInputBufferSubsystem* InputBuffer = GetFirstPlayerBuffer(World)) InputBuffer->StartInputRecording();
+		})
+	);
+
+	FAutoConsoleCommandWithWorldAndArgs CmdStopRecording
+	(
+		TEXT("ib.Recording.Stop"),
+		TEXT("Stops recording input & writes the recording. Args: [FilePath] (Defaults to Saved/Profiling/InputRecordings/InputRecording.ibrec)"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UInputBufferSubsystem* InputBuffer = GetFirstPlayerBuffer(World)) InputBuffer->StopInputRecording(GetRecordingPath(Args));
+		})
+	);
+
+	FAutoConsoleCommandWithWorldAndArgs CmdReplayRecording
+	(
+		TEXT("ib.Recording.Replay"),
+		TEXT("Replays an input recording through the first local player's input buffer as fast as possible. Args: [FilePath]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UInputBufferSubsystem* InputBuffer = GetFirstPlayerBuffer(World)) InputBuffer->ReplayInputRecording(GetRecordingPath(Args));
+		})
+	);
+}
+
 
 void UInputBufferSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
+	InitializeBufferSettings();
+
+	IB_FLog(Error, "Input Buffer Initialized")
+}
+
+void UInputBufferSubsystem::InitializeBufferSettings()
+{
 	bInitialized = false;
 	bInputDisabled = false;
 	ElapsedTime = 0;
-	ButtonInputValidFrame = TMap<FGameplayTag, FBufferStateTuple>();
+	BufferClock = 0;
+	ButtonInputValidFrame = TArray<FBufferStateTuple>();
 
 	// Initialize
 	CachedActionIDs = FGameplayTagContainer();
 	CachedDirectionalActionIDs = FGameplayTagContainer();
-	RawValueContainer = TMap<FGameplayTag, FRawInputValue>();
+	ActionSlots = TMap<FGameplayTag, int32>();
+	SlotActionIDs = TArray<FGameplayTag>();
+	RawValueContainer = TArray<FRawInputValue>();
+	bAnyRelativeMotionAction = false;
+	bEvaluateAllBindings = true;
 
 	// Set input buffer settings from project
 	BUFFER_SIZE = UCoreFrameworkStatics::GetInputBufferFullFrameWindow();
 	BUTTON_BUFFER_SIZE = UCoreFrameworkStatics::GetInputBufferButtonFrameWindow();
 	TICK_INTERVAL = UCoreFrameworkStatics::GetInputBufferTickInterval();
-
-	IB_FLog(Error, "Input Buffer Initialized")
+	bTimestampedSampling = UCoreFrameworkStatics::GetInputBufferTimestampedSampling();
+	BUTTON_WINDOW_MASK = BUTTON_BUFFER_SIZE >= 64 ? MAX_uint64 : (1ull << BUTTON_BUFFER_SIZE) - 1;
 }
 
 void UInputBufferSubsystem::Deinitialize()
@@ -63,13 +145,41 @@ void UInputBufferSubsystem::Tick(float DeltaTime)
 		return;
 	}
 
-	// Increment our timer and update the buffer if we've met our tick interval
-	ElapsedTime += DeltaTime;
-	if (ElapsedTime >= TICK_INTERVAL)
+	// Update the buffer once for every whole tick interval elapsed, the remainder is kept so the update rate doesn't drift with the frame rate
+	int32 NumUpdates;
+	if (bTimestampedSampling)
 	{
-		UpdateBuffer();
-		ElapsedTime = 0.f;
+		const double Now = FPlatformTime::Seconds();
+		NumUpdates = FMath::FloorToInt32((Now - BufferClock) / TICK_INTERVAL);
+		
+		// Past a full buffer of updates the buffer is entirely overwritten anyway, skip the frames that wouldn't be seen
+		if (NumUpdates > BUFFER_SIZE)
+		{
+			BufferClock += (NumUpdates - BUFFER_SIZE) * TICK_INTERVAL;
+			NumUpdates = BUFFER_SIZE;
+		}
+
+		// Each update registers the input received during its own interval, so input lands on the buffer frame it occurred in
+		for (int32 Update = 0; Update < NumUpdates; Update++)
+		{
+			BufferClock += TICK_INTERVAL;
+			RegisterPendingRawInputs(BufferClock);
+			UpdateBuffer();
+		}
+		ElapsedTime = Now - BufferClock;
+	}
+	else
+	{
+		ElapsedTime += DeltaTime;
+		NumUpdates = FMath::FloorToInt32(ElapsedTime / TICK_INTERVAL);
+		ElapsedTime -= NumUpdates * TICK_INTERVAL;
+		
+		for (int32 Update = 0; Update < FMath::Min<int32>(NumUpdates, BUFFER_SIZE); Update++)
+		{
+			UpdateBuffer();
+		}
 	}
+	if (InputRecorder.IsRecording()) InputRecorder.RecordTick();
 
 	// Evaluate Events (More frequently than buffer updates)
 	EvaluateEvents();
@@ -106,130 +216,504 @@ void UInputBufferSubsystem::InitializeInputMapping(UEnhancedInputComponent* Inpu
 	Subsystem->ClearAllMappings();
 	Subsystem->AddMappingContext(InputMap->InputActionMap, 0);
 	
-	auto InputActionCache = InputMap->GetInputActions();
+	/* Slots have to be assigned before binding, EIC events are routed to the buffer by slot */
+	InitializeInputBufferData();
+	
+	const auto& InputActionCache = InputMap->GetInputActions();
 	
 	/* Generate Action Bindings */
 	for (auto Action : InputActionCache)
 	{
-		RawValueContainer.Add(Action->GetID(), FRawInputValue());
+		const int32 Slot = GetActionSlot(Action->GetID());
+		if (Slot == INDEX_NONE) continue;
 
-		InputComponent->BindAction(Action, ETriggerEvent::Triggered, this, &UInputBufferSubsystem::TriggerInput, Action->GetID());
-		InputComponent->BindAction(Action, ETriggerEvent::Completed, this, &UInputBufferSubsystem::CompleteInput, Action->GetID());
+		InputComponent->BindAction(Action, ETriggerEvent::Triggered, this, &UInputBufferSubsystem::TriggerInput, Slot);
+		InputComponent->BindAction(Action, ETriggerEvent::Completed, this, &UInputBufferSubsystem::CompleteInput, Slot);
 	}
-
-	InitializeInputBufferData();
 }
 
 void UInputBufferSubsystem::InitializeInputBufferData()
 {
 	bInitialized = true;
-	InputBuffer = TBufferContainer<FBufferFrame>(BUFFER_SIZE);
 	
-	/* Populate the buffer */
-	for (int i = 0; i < BUFFER_SIZE; i++)
+	/* Each action's slot is its index in the input map, frames & tracking data are laid out by it */
+	ActionSlots = InputMap->GetActionIndices();
+	SlotActionIDs = InputMap->GetActionIDArray();
+	for (const FGameplayTag& ID : SlotActionIDs)
 	{
-		FBufferFrame NewFrame = FBufferFrame();
-		NewFrame.InitializeFrame(CachedActionIDs);
-		InputBuffer.PushBack(NewFrame);
+		IB_FLog(Display, "[%s] - Action Added To Buffer", *ID.ToString())
 	}
+	const int32 NumSlots = SlotActionIDs.Num();
+	
+	RawValueContainer.Init(FRawInputValue(), NumSlots);
+	PendingRawInputs.Reset();
+	ElapsedTime = 0;
+	BufferClock = FPlatformTime::Seconds();
+	
+	/* Populate the buffer */
+	InputBuffer.Initialize(BUFFER_SIZE, NumSlots);
 	
 	/* Setup "tracking" data */
-	ButtonInputValidFrame.Empty();
-	for (auto ID : InputMap->GetActionIDs())
-	{
-		IB_FLog(Display, "[%s] - Action Added To Buffer", *ID.ToString())
-		ButtonInputValidFrame.Add(ID, FBufferStateTuple());
-	}
+	ButtonInputValidFrame.Init(FBufferStateTuple(), NumSlots);
+	ButtonFrameTrackers.Init(FButtonFrameTracker(), NumSlots);
+	LastEvaluatedButtonValidFrame.Init(FBufferStateTuple(), NumSlots);
 
-	DirectionalInputValidFrame.Empty();
-	for (auto ID : InputMap->GetDirectionalIDs())
+	DirectionalSlots = InputMap->GetDirectionalIndices();
+	SlotDirectionalIDs = InputMap->GetDirectionalIDArray();
+	for (const FGameplayTag& ID : SlotDirectionalIDs)
 	{
 		IB_FLog(Display, "[%s] - Directional Added To Buffer", *ID.ToString())
-		DirectionalInputValidFrame.Add(ID, -1);
 	}
+	DirectionalInputValidFrame.Init(-1, SlotDirectionalIDs.Num());
+	DirectionalUnconsumedFrames.Init(BUFFER_SIZE, SlotDirectionalIDs.Num());
+	LastEvaluatedDirectionalValidFrame.Init(-1, SlotDirectionalIDs.Num());
+	bEvaluateAllBindings = true;
+
+	/* Compile motion commands, frame caches are sized once here so directional evaluation doesn't allocate */
+	MotionAutomata.Reset();
+	bAnyRelativeMotionAction = false;
+	if (InputMap->DirectionalActionMap)
+	{
+		for (const auto MotionAction : InputMap->DirectionalActionMap->GetMappings())
+		{
+			if (!MotionAction) continue;
+			FMotionCommandAutomaton& Automaton = MotionAutomata.AddDefaulted_GetRef();
+			Automaton.Compile(MotionAction);
+			Automaton.DirectionalSlot = GetDirectionalSlot(Automaton.InputID);
+			bAnyRelativeMotionAction |= !Automaton.bAngleChange && Automaton.bRelativeToPlayer;
+		}
+	}
+	FrameAxisInputs.Init(FVector2D::ZeroVector, BUFFER_SIZE);
+	FrameDirections.Init(EMotionCommandDirection::NEUTRAL, BUFFER_SIZE);
+	FrameRelativeDirections.Init(EMotionCommandDirection::NEUTRAL, BUFFER_SIZE);
+
+	/* Snapshots saved off the previous layout can't be restored anymore */
+	if (SnapshotRing.IsInitialized()) InitializeSnapshots(SnapshotRing.Num());
+}
+
+void UInputBufferSubsystem::InitializeSnapshots(const int32 NumSnapshots)
+{
+	FInputBufferSnapshotLayout Layout;
+	Layout.Compute(InputBuffer.NumFrames(), SlotActionIDs.Num(), SlotDirectionalIDs.Num());
+	SnapshotRing.Initialize(Layout, NumSnapshots);
+}
+
+bool UInputBufferSubsystem::SaveSnapshot(const int32 Frame)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SaveSnapshot)
+	
+	uint8* Snapshot = SnapshotRing.Allocate(Frame);
+	if (!Snapshot) return false;
+
+	const FInputBufferSnapshotLayout& Layout = SnapshotRing.GetLayout();
+	const int32 NumSlots = Layout.NumSlots;
+	FInputBufferSnapshotScalars& Scalars = *reinterpret_cast<FInputBufferSnapshotScalars*>(Snapshot + Layout.Scalars);
+	InputBuffer.WriteRows(
+		reinterpret_cast<FInputActionValue*>(Snapshot + Layout.Values),
+		reinterpret_cast<int32*>(Snapshot + Layout.HoldTimes),
+		reinterpret_cast<bool*>(Snapshot + Layout.UsedFlags),
+		reinterpret_cast<bool*>(Snapshot + Layout.ReleaseFlags),
+		Scalars.FrontRow);
+
+	FMemory::Memcpy(Snapshot + Layout.ValidFrames, ButtonInputValidFrame.GetData(), NumSlots * sizeof(FBufferStateTuple));
+	FMemory::Memcpy(Snapshot + Layout.LastEvaluatedValidFrames, LastEvaluatedButtonValidFrame.GetData(), NumSlots * sizeof(FBufferStateTuple));
+	FMemory::Memcpy(Snapshot + Layout.FrameTrackers, ButtonFrameTrackers.GetData(), NumSlots * sizeof(FButtonFrameTracker));
+	FMemory::Memcpy(Snapshot + Layout.RawValues, RawValueContainer.GetData(), NumSlots * sizeof(FRawInputValue));
+
+	FMemory::Memcpy(Snapshot + Layout.DirectionalValidFrames, DirectionalInputValidFrame.GetData(), Layout.NumDirectionals * sizeof(int8));
+	FMemory::Memcpy(Snapshot + Layout.DirectionalUnconsumedFrames, DirectionalUnconsumedFrames.GetData(), Layout.NumDirectionals * sizeof(uint8));
+	FMemory::Memcpy(Snapshot + Layout.LastEvaluatedDirectionalValidFrames, LastEvaluatedDirectionalValidFrame.GetData(), Layout.NumDirectionals * sizeof(int8));
+
+	Scalars.ElapsedTime = ElapsedTime;
+	Scalars.BufferClock = BufferClock;
+	Scalars.bEvaluateAllBindings = bEvaluateAllBindings;
+	
+	return true;
+}
+
+bool UInputBufferSubsystem::RestoreSnapshot(const int32 Frame)
+{
+	SCOPE_CYCLE_COUNTER(STAT_RestoreSnapshot)
+	
+	const uint8* Snapshot = SnapshotRing.Find(Frame);
+	if (!Snapshot) return false;
+
+	// The rows are restored in storage order along with the row the front was in
+	const FInputBufferSnapshotLayout& Layout = SnapshotRing.GetLayout();
+	const int32 NumSlots = Layout.NumSlots;
+	const FInputBufferSnapshotScalars& Scalars = *reinterpret_cast<const FInputBufferSnapshotScalars*>(Snapshot + Layout.Scalars);
+	InputBuffer.ReadRows(
+		reinterpret_cast<const FInputActionValue*>(Snapshot + Layout.Values),
+		reinterpret_cast<const int32*>(Snapshot + Layout.HoldTimes),
+		reinterpret_cast<const bool*>(Snapshot + Layout.UsedFlags),
+		reinterpret_cast<const bool*>(Snapshot + Layout.ReleaseFlags),
+		Scalars.FrontRow);
+
+	FMemory::Memcpy(ButtonInputValidFrame.GetData(), Snapshot + Layout.ValidFrames, NumSlots * sizeof(FBufferStateTuple));
+	FMemory::Memcpy(LastEvaluatedButtonValidFrame.GetData(), Snapshot + Layout.LastEvaluatedValidFrames, NumSlots * sizeof(FBufferStateTuple));
+	FMemory::Memcpy(ButtonFrameTrackers.GetData(), Snapshot + Layout.FrameTrackers, NumSlots * sizeof(FButtonFrameTracker));
+	FMemory::Memcpy(RawValueContainer.GetData(), Snapshot + Layout.RawValues, NumSlots * sizeof(FRawInputValue));
+
+	FMemory::Memcpy(DirectionalInputValidFrame.GetData(), Snapshot + Layout.DirectionalValidFrames, Layout.NumDirectionals * sizeof(int8));
+	FMemory::Memcpy(DirectionalUnconsumedFrames.GetData(), Snapshot + Layout.DirectionalUnconsumedFrames, Layout.NumDirectionals * sizeof(uint8));
+	FMemory::Memcpy(LastEvaluatedDirectionalValidFrame.GetData(), Snapshot + Layout.LastEvaluatedDirectionalValidFrames, Layout.NumDirectionals * sizeof(int8));
+
+	ElapsedTime = Scalars.ElapsedTime;
+	BufferClock = Scalars.BufferClock; // Timestamped sampling recomputes ElapsedTime off the clock, both have to be rolled back
+	bEvaluateAllBindings = Scalars.bEvaluateAllBindings;
+
+	// Timestamped input queued for frames after the snapshot belongs to the discarded timeline
+	PendingRawInputs.Reset();
+	
+	return true;
 }
 
 //BEGIN Input Registration Events
-void UInputBufferSubsystem::TriggerInput(const FInputActionInstance& ActionInstance, const FGameplayTag InputID)
+void UInputBufferSubsystem::TriggerInput(const FInputActionInstance& ActionInstance, const int32 Slot)
+{
+	RegisterRawInput(FRawInputValue(ActionInstance), Slot);
+}
+
+void UInputBufferSubsystem::CompleteInput(const FInputActionInstance& ActionInstance, const int32 Slot)
 {
-	RawValueContainer[InputID] = FRawInputValue(ActionInstance);
+	RegisterRawInput(FRawInputValue(ActionInstance), Slot);
 }
 
-void UInputBufferSubsystem::CompleteInput(const FInputActionInstance& ActionInstance, const FGameplayTag InputID)
+void UInputBufferSubsystem::RegisterRawInput(const FRawInputValue& RawValue, const int32 Slot)
 {
-	RawValueContainer[InputID] = FRawInputValue(ActionInstance);
+	if (!bTimestampedSampling)
+	{
+		RawValueContainer[Slot] = RawValue;
+		if (InputRecorder.IsRecording()) InputRecorder.RecordInput(Slot, RawValue, FPlatformTime::Seconds());
+		return;
+	}
+
+	FTimestampedRawInput& PendingInput = PendingRawInputs.AddDefaulted_GetRef();
+	PendingInput.Timestamp = FPlatformTime::Seconds();
+	PendingInput.Slot = Slot;
+	PendingInput.Value = RawValue;
+}
+
+void UInputBufferSubsystem::RegisterPendingRawInputs(const double FrameEndTime)
+{
+	// Inputs are queued in the order they were received, so every input of this frame is at the front
+	int32 NumRegistered = 0;
+	while (NumRegistered < PendingRawInputs.Num() && PendingRawInputs[NumRegistered].Timestamp < FrameEndTime)
+	{
+		const FTimestampedRawInput& PendingInput = PendingRawInputs[NumRegistered++];
+		RawValueContainer[PendingInput.Slot] = PendingInput.Value;
+		if (InputRecorder.IsRecording()) InputRecorder.RecordInput(PendingInput.Slot, PendingInput.Value, PendingInput.Timestamp);
+	}
+
+	if (NumRegistered == PendingRawInputs.Num())
+	{
+		PendingRawInputs.Reset();
+	}
+	else if (NumRegistered > 0)
+	{
+		PendingRawInputs.RemoveAt(0, NumRegistered);
+	}
 }
 //END Input Registration Events
 
+bool UInputBufferSubsystem::StartInputRecording()
+{
+	if (!bInitialized || InputRecorder.IsRecording()) return false;
+
+	InputRecorder.Begin(SlotActionIDs, TICK_INTERVAL);
+	IB_FLog(Log, "Started recording input")
+	return true;
+}
+
+bool UInputBufferSubsystem::StopInputRecording(const FString& FilePath)
+{
+	if (!InputRecorder.IsRecording()) return false;
+
+	const bool bSaved = InputRecorder.End(FilePath);
+	if (bSaved)
+	{
+		IB_FLog(Log, "Saved input recording to [%s]", *FilePath)
+	}
+	else
+	{
+		IB_FLog(Error, "Failed to save input recording to [%s]", *FilePath)
+	}
+	return bSaved;
+}
+
+int32 UInputBufferSubsystem::ReplayInputRecording(const FString& FilePath, UInputBufferMap* ReplayInputMap)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ReplayRecording)
+	
+	if (InputRecorder.IsRecording())
+	{
+		IB_FLog(Warning, "Can't replay [%s] while recording input", *FilePath)
+		return INDEX_NONE;
+	}
+
+	FInputRecordingReader Recording;
+	if (!Recording.Open(FilePath))
+	{
+		IB_FLog(Error, "Failed to open input recording [%s]", *FilePath)
+		return INDEX_NONE;
+	}
+
+	// Replays don't need EIC, recorded input is fed straight into the buffer so the input map only has to be generated
+	if (ReplayInputMap)
+	{
+		InputMap = ReplayInputMap;
+		InputMap->GenerateInputActions();
+		CachedActionIDs = InputMap->GetActionIDs();
+		CachedDirectionalActionIDs = InputMap->GetDirectionalIDs();
+	}
+	if (!InputMap) return INDEX_NONE;
+
+	// Replay from a clean buffer, bindings are kept so their events are evaluated along the replay
+	InitializeInputBufferData();
+
+	if (!FMath::IsNearlyEqual(Recording.GetHeader().TickInterval, TICK_INTERVAL))
+	{
+		IB_FLog(Warning, "Input recording [%s] was recorded with a different tick interval, hold times will differ", *FilePath)
+	}
+
+	// Recorded slots are remapped by action ID, the input map might have changed since recording
+	TArray<int32> SlotRemap;
+	for (const FName& SlotName : Recording.GetSlotNames())
+	{
+		const int32 Slot = GetActionSlot(FGameplayTag::RequestGameplayTag(SlotName, false));
+		if (Slot == INDEX_NONE)
+		{
+			IB_FLog(Warning, "[%s] - Recorded action isn't buffered, its input is skipped", *SlotName.ToString())
+		}
+		SlotRemap.Add(Slot);
+	}
+
+	// Recorded input is already placed on the update that registered it, it's registered directly instead of re-timestamped
+	TGuardValue<bool> SamplingGuard(bTimestampedSampling, false);
+	
+	const TArrayView<const FRecordedRawInput> Inputs = Recording.GetInputs();
+	int32 NextInput = 0;
+	uint32 NumUpdates = 0;
+	for (const uint32 NumTickUpdates : Recording.GetTicks())
+	{
+		for (uint32 Update = 0; Update < NumTickUpdates; Update++, NumUpdates++)
+		{
+			for (; NextInput < Inputs.Num() && Inputs[NextInput].Update <= NumUpdates; NextInput++)
+			{
+				const int32 Slot = SlotRemap.IsValidIndex(Inputs[NextInput].Slot) ? SlotRemap[Inputs[NextInput].Slot] : INDEX_NONE;
+				if (Slot != INDEX_NONE) RegisterRawInput(Inputs[NextInput].ToRawValue(), Slot);
+			}
+			UpdateBuffer();
+		}
+		EvaluateEvents();
+	}
+
+	IB_FLog(Log, "Replayed [%s], %d buffer updates", *FilePath, NumUpdates)
+	return NumUpdates;
+}
+
 void UInputBufferSubsystem::UpdateBuffer()
 {
 	SCOPE_CYCLE_COUNTER(STAT_UpdateBuffer)
+
+	if (InputRecorder.IsRecording()) InputRecorder.RecordUpdate();
 	
-	/* Each frame, push a new list of inputs and their states to the front */
-	FBufferFrame FrontFrame = InputBuffer.Front();
-	FBufferFrame NewFrame = FBufferFrame();
-	NewFrame.InitializeFrame(CachedActionIDs);
-	NewFrame.CopyFrameState(CachedActionIDs, FrontFrame);
-	NewFrame.UpdateFrameState(RawValueContainer);
+	/* Each frame, recycle the oldest frame as the new front and carry the previous front's state into it */
+	InputBuffer.Advance(RawValueContainer);
 	
-	/* Push newly updated frame to the buffer */
-	InputBuffer.PushFront(NewFrame);
+	/* Shift each input's tracked window and register the new front frame with it */
+	for (int32 Slot = 0; Slot < SlotActionIDs.Num(); Slot++)
+	{
+		const bool bPress = InputBuffer.CanInvokePress(0, Slot);
+		const bool bRelease = InputBuffer.CanInvokeRelease(0, Slot);
+		const bool bEvent = bPress || bRelease || InputBuffer.CanInvokeHold(0, Slot);
+		ButtonFrameTrackers[Slot].Advance(BUTTON_WINDOW_MASK, bPress, bEvent, InputBuffer.IsUsed(0, Slot), bRelease);
+	}
 	
 	/* Store the frame value in which each action input can be used */
-	for (const auto InputID : InputMap->GetActionIDs())
+	const bool bIncremental = InputBufferCVars::IncrementalValidFrames && IsWindowTracked();
+	for (int32 Slot = 0; Slot < SlotActionIDs.Num(); Slot++)
 	{
-		ButtonInputValidFrame[InputID].ResetAll();
-		bool bOnOlderState = true;
-
-		// We fill out the "Old" input buffer state until we encounter a second valid input, then copy the old into the new and fill out the old
-		/* Loop through all buffer frames in order of newest to oldest */
-		for (int frame = BUTTON_BUFFER_SIZE - 1; frame >= 0; frame--)
+		if (bIncremental)
 		{
-			auto FrameState = InputBuffer[frame].InputsFrameState[InputID];
+			ResolveButtonValidFrame(Slot, ButtonInputValidFrame[Slot]);
 
-			/* Evaluate the frame state of the given input */
-			if (FrameState.CanInvokePress())
+#if DO_CHECK
+			if (InputBufferCVars::ValidateIncrementalValidFrames)
 			{
-				ButtonInputValidFrame[InputID].SetFrameStateValues(bOnOlderState, frame, 0, false);
-				bOnOlderState = false;
-			}
-			if (FrameState.CanInvokeHold())
-			{
-				ButtonInputValidFrame[InputID].SetFrameStateValues(bOnOlderState, frame, RawValueContainer[InputID].GetTriggeredTime(), true); 
-			}
-			if (FrameState.CanInvokeRelease())
-			{
-				ButtonInputValidFrame[InputID].SetFrameStateValues(bOnOlderState, frame, -RawValueContainer[InputID].GetTriggeredTime(), true);
+				FBufferStateTuple RescannedFrame;
+				EvaluateButtonValidFrame(Slot, RescannedFrame);
+				ensureMsgf(RescannedFrame.Equals(ButtonInputValidFrame[Slot]), TEXT("INPUT BUFFER: Incremental valid frame of [%s] diverged from the window rescan"), *SlotActionIDs[Slot].ToString());
 			}
+#endif
+		}
+		else
+		{
+			EvaluateButtonValidFrame(Slot, ButtonInputValidFrame[Slot]);
 		}
 	}
 
 	/* Store the frame value in which each directional input can be used */
-	if (!InputMap->DirectionalActionMap) return;
+	if (!InputMap->DirectionalActionMap || MotionAutomata.IsEmpty()) return;
+
+	// Consumed matches age along with the buffer, the frames they were matched in are freed once they leave it
+	for (uint8& UnconsumedFrames : DirectionalUnconsumedFrames)
+	{
+		UnconsumedFrames = FMath::Min<int32>(UnconsumedFrames + 1, BUFFER_SIZE);
+	}
+	
+	// Input for directional input evaluation is stored in UMotionMappingContext
+	const int32 DirectionInputAxisSlot = GetActionSlot(InputMap->DirectionalActionMap->GetDirectionalActionID());
+	if (DirectionInputAxisSlot == INDEX_NONE) return;
+
+	/* Classify the directional axis of every frame once, every motion action reads from the same cache */
+	FVector InputForward = FVector::ZeroVector, InputRight = FVector::ZeroVector, PlayerForward = FVector::ZeroVector, PlayerRight = FVector::ZeroVector;
+	ComputeDirectionalBasis(InputForward, InputRight, PlayerForward, PlayerRight);
 	
-	for (const auto DirectionalInput : InputMap->DirectionalActionMap->GetMappings())
+	for (int frame = 0; frame < BUFFER_SIZE; frame++)
 	{
-		const FGameplayTag InputID = DirectionalInput->GetID();
-		
-		// Input for directional input evaluation is stored in UMotionMappingContext
-		const FGameplayTag DirectionInputAxisID = InputMap->DirectionalActionMap->GetDirectionalActionID();
+		const FVector2D DirectionInputVector = InputBuffer.GetValue(frame, DirectionInputAxisSlot).Get<FVector2D>();
+		FrameAxisInputs[frame] = DirectionInputVector;
 		
-		DirectionalInputValidFrame[InputID] = -1;
-		DirectionalInput->Reset(); // Resets transient values that are to be checked during the buffer window
+		if (DirectionInputVector.IsZero())
+		{
+			FrameDirections[frame] = EMotionCommandDirection::NEUTRAL;
+			FrameRelativeDirections[frame] = EMotionCommandDirection::NEUTRAL;
+			continue;
+		}
 		
-		for (int frame = BUFFER_SIZE-1; frame >= 0; frame--) // Iterating From Oldest To Newest (To Check Sequence Order)
+		FrameDirections[frame] = UMotionAction::ClassifyAxisDirection(FVector(DirectionInputVector.X, DirectionInputVector.Y, 0), FVector(0, 1, 0), FVector(1, 0, 0));
+		if (bAnyRelativeMotionAction)
 		{
-			const FVector2D DirectionInputVector = InputBuffer[frame].InputsFrameState[DirectionInputAxisID].Value.Get<FVector2D>();
-			FVector ProcessedInputVector, PlayerForward, PlayerRight;
-			ProcessDirectionVector(DirectionInputVector, ProcessedInputVector, PlayerForward, PlayerRight);
-			
-			if (DirectionalInput->CheckMotionDirection(DirectionInputVector, ProcessedInputVector, PlayerForward, PlayerRight))
+			const FVector ProcessedInputVector = InputForward * DirectionInputVector.Y + InputRight * DirectionInputVector.X;
+			FrameRelativeDirections[frame] = UMotionAction::ClassifyAxisDirection(ProcessedInputVector, PlayerForward, PlayerRight);
+		}
+	}
+
+	/* Step every motion action through the buffer in a single pass */
+	int32 NumUnresolved = 0;
+	for (FMotionCommandAutomaton& Automaton : MotionAutomata)
+	{
+		Automaton.Reset(); // Resets transient values that are to be checked during the buffer window
+		if (Automaton.IsValid()) NumUnresolved++;
+	}
+	
+	for (int frame = BUFFER_SIZE-1; frame >= 0 && NumUnresolved > 0; frame--) // Iterating From Oldest To Newest (To Check Sequence Order)
+	{
+		for (FMotionCommandAutomaton& Automaton : MotionAutomata)
+		{
+			if (Automaton.ValidFrame >= 0 || !Automaton.IsValid()) continue;
+			if (Automaton.DirectionalSlot != INDEX_NONE && frame >= DirectionalUnconsumedFrames[Automaton.DirectionalSlot]) continue;
+
+			bool bSatisfied;
+			if (Automaton.bAngleChange)
 			{
-				DirectionalInputValidFrame[InputID] = frame; 
-				break; // Break out of inner loop otherwise the frame value won't represent the frame in which the input is registered and will always default to 0 if directional was satisfied
+				const FVector2D& DirectionInputVector = FrameAxisInputs[frame];
+				const FVector ProcessedInputVector = InputForward * DirectionInputVector.Y + InputRight * DirectionInputVector.X;
+				bSatisfied = Automaton.Action->CheckMotionDirection(DirectionInputVector, ProcessedInputVector, PlayerForward, PlayerRight);
 			}
+			else
+			{
+				const uint8 Direction = Automaton.bRelativeToPlayer ? FrameRelativeDirections[frame] : FrameDirections[frame];
+				bSatisfied = Automaton.Step(static_cast<EMotionCommandDirection>(Direction));
+			}
+
+			// Only the first satisfied frame is kept, otherwise the frame value won't represent the frame in which the input is registered
+			if (bSatisfied)
+			{
+				Automaton.ValidFrame = frame;
+				NumUnresolved--;
+			}
+		}
+	}
+
+	for (const FMotionCommandAutomaton& Automaton : MotionAutomata)
+	{
+		if (Automaton.DirectionalSlot != INDEX_NONE) DirectionalInputValidFrame[Automaton.DirectionalSlot] = Automaton.ValidFrame;
+	}
+}
+
+void UInputBufferSubsystem::EvaluateButtonValidFrame(const int32 Slot, FBufferStateTuple& OutValidFrame)
+{
+	OutValidFrame.ResetAll();
+	bool bOnOlderState = true;
+
+	// We fill out the "Old" input buffer state until we encounter a second valid input, then copy the old into the new and fill out the old
+	/* Loop through all buffer frames in order of newest to oldest */
+	for (int frame = BUTTON_BUFFER_SIZE - 1; frame >= 0; frame--)
+	{
+		/* Evaluate the frame state of the given input */
+		if (CanInvokePress(frame, Slot))
+		{
+			OutValidFrame.SetFrameStateValues(bOnOlderState, frame, 0, false);
+			bOnOlderState = false;
+		}
+		if (InputBuffer.CanInvokeHold(frame, Slot))
+		{
+			OutValidFrame.SetFrameStateValues(bOnOlderState, frame, RawValueContainer[Slot].GetTriggeredTime(), true); 
+		}
+		if (InputBuffer.CanInvokeRelease(frame, Slot))
+		{
+			OutValidFrame.SetFrameStateValues(bOnOlderState, frame, -RawValueContainer[Slot].GetTriggeredTime(), true);
+		}
+	}
+}
+
+void UInputBufferSubsystem::ResolveButtonValidFrame(const int32 Slot, FBufferStateTuple& OutValidFrame)
+{
+	OutValidFrame.ResetAll();
+	
+	// Equivalent to the oldest to newest rescan: the oldest press always ends up in the older state, and whichever event is newest
+	// ends up in the older state if there was no press, or in the newer state if it came after that press
+	const FButtonFrameTracker& Tracker = ButtonFrameTrackers[Slot];
+	const int8 OldestPress = Tracker.GetOldestPress();
+	const int8 NewestEvent = Tracker.GetNewestEvent();
+
+	if (OldestPress >= 0)
+	{
+		OutValidFrame.SetFrameStateValues(true, OldestPress, 0, false);
+	}
+	
+	if (NewestEvent < 0 || (OldestPress >= 0 && NewestEvent >= OldestPress)) return;
+
+	const bool bOnOlderState = OldestPress < 0;
+	if (CanInvokePress(NewestEvent, Slot))
+	{
+		OutValidFrame.SetFrameStateValues(bOnOlderState, NewestEvent, 0, false);
+	}
+	else if (InputBuffer.CanInvokeHold(NewestEvent, Slot))
+	{
+		OutValidFrame.SetFrameStateValues(bOnOlderState, NewestEvent, RawValueContainer[Slot].GetTriggeredTime(), true);
+	}
+	else if (InputBuffer.CanInvokeRelease(NewestEvent, Slot))
+	{
+		OutValidFrame.SetFrameStateValues(bOnOlderState, NewestEvent, -RawValueContainer[Slot].GetTriggeredTime(), true);
+	}
+}
+
+void UInputBufferSubsystem::GatherDirtyInputs()
+{
+	DirtyInputTags.Reset();
+
+	for (int32 Slot = 0; Slot < ButtonInputValidFrame.Num(); Slot++)
+	{
+		if (bEvaluateAllBindings || !ButtonInputValidFrame[Slot].Equals(LastEvaluatedButtonValidFrame[Slot]))
+		{
+			LastEvaluatedButtonValidFrame[Slot] = ButtonInputValidFrame[Slot];
+			DirtyInputTags.Add(SlotActionIDs[Slot]);
+		}
+	}
+
+	for (int32 Slot = 0; Slot < DirectionalInputValidFrame.Num(); Slot++)
+	{
+		if (bEvaluateAllBindings || DirectionalInputValidFrame[Slot] != LastEvaluatedDirectionalValidFrame[Slot])
+		{
+			LastEvaluatedDirectionalValidFrame[Slot] = DirectionalInputValidFrame[Slot];
+			DirtyInputTags.Add(SlotDirectionalIDs[Slot]);
 		}
 	}
+
+	bEvaluateAllBindings = false;
 }
 
 void UInputBufferSubsystem::EvaluateEvents()
@@ -239,30 +723,45 @@ void UInputBufferSubsystem::EvaluateEvents()
 	/* Check if input is even enabled */
 	if (bInputDisabled) return;
 
-	// BUG: Somewhere here I'm causing an esnure fail by deleting an element in an array during the loop
+	/* Only bindings whose inputs changed since the last evaluation (or were just bound) can have anything new to fire, except continuous bindings which fire while their state holds */
+	GatherDirtyInputs();
+	
+	const bool bAnyPendingBindings = ActionDelegates.HasPendingBindings() || ActionSeqDelegates.HasPendingBindings() || DirectionalDelegates.HasPendingBindings() || DirectionAndActionDelegates.HasPendingBindings();
+	const bool bAnyContinuousBindings = ActionDelegates.HasContinuousBindings() || ActionSeqDelegates.HasContinuousBindings() || DirectionalDelegates.HasContinuousBindings() || DirectionAndActionDelegates.HasContinuousBindings();
+	if (DirtyInputTags.IsEmpty() && !bAnyPendingBindings && !bAnyContinuousBindings) return;
+
+	// NOTE: Bindings are looked up again by ID right before being evaluated, and their delegates are copied before executing, so
+	// binding or unbinding from within a bound event is safe
 	
 	// NOTE: Consuming has possible overlap w/ ActionEvent if SEQUENCE_ButtonFirst
 	/* Evaluate Directional + Action Events */
-	for (auto DirActSeqBinding = DirectionAndActionDelegates.CreateIterator(); DirActSeqBinding; ++DirActSeqBinding)
+	DirectionAndActionDelegates.Gather(DirtyInputTags, GatheredBindings);
+	for (const FGatheredInputBinding& Gathered : GatheredBindings)
 	{
+		const auto* Entry = DirectionAndActionDelegates.Find(Gathered.ID);
+		if (!Entry || Entry->Order != Gathered.Order) continue;
+		
 		// If no binding for the delegate, skip and delete same if the value is invalid
-		if (!DirActSeqBinding->Key.Delegate.IsBound())
+		if (!Entry->Binding.Delegate.IsBound())
 		{
-			IB_FLog(Error, "Delegate In Action Bindings Not Bound [%s]", *DirActSeqBinding->Key.Delegate.GetFunctionName().ToString());
-			DirActSeqBinding.RemoveCurrent();
+			IB_FLog(Error, "Delegate In Action Bindings Not Bound [%s]", *Entry->Binding.Delegate.GetFunctionName().ToString());
+			DirectionAndActionDelegates.Remove(FDirectionalSequenceBinding(Entry->Binding));
 			continue;
 		}
-		
-		if (ButtonInputValidFrame.Contains(DirActSeqBinding->Value.InputAction) && DirectionalInputValidFrame.Contains(DirActSeqBinding->Value.DirectionalAction))
+
+		const FDirectionalAndActionDelegateHandle Handle = Entry->Handle;
+		const int32 ActionSlot = GetActionSlot(Handle.InputAction);
+		const int32 DirectionalSlot = GetDirectionalSlot(Handle.DirectionalAction);
+		if (ActionSlot != INDEX_NONE && DirectionalSlot != INDEX_NONE)
 		{
-			const auto ActionState = ButtonInputValidFrame[DirActSeqBinding->Value.InputAction].OlderState;
-			const auto DirectionalFrame = DirectionalInputValidFrame[DirActSeqBinding->Value.DirectionalAction];
+			const auto ActionState = ButtonInputValidFrame[ActionSlot].OlderState;
+			const auto DirectionalFrame = DirectionalInputValidFrame[DirectionalSlot];
 			
 			if (ActionState.IsPress() && DirectionalFrame > 0)
 			{
 				// Skip if order matters and first action is more recent than second
 				bool bInvokeEvent = true;
-				switch (DirActSeqBinding->Value.SequenceOrder)
+				switch (Handle.SequenceOrder)
 				{
 					case SEQUENCE_None:
 						break;
@@ -276,155 +775,181 @@ void UInputBufferSubsystem::EvaluateEvents()
 				}
 		
 				// Otherwise invoke event and maybe consume input
-				if (bInvokeEvent && !IsInputConsumed(DirActSeqBinding->Value.InputAction))
+				if (bInvokeEvent && !IsInputConsumed(ActionSlot))
 				{
-					auto Value = InputBuffer[ButtonInputValidFrame[DirActSeqBinding->Value.InputAction].OlderState.GetAssociatedFrame()].InputsFrameState[DirActSeqBinding->Value.InputAction].Value;
-					DirActSeqBinding->Key.Delegate.Execute(Value, ButtonInputValidFrame[DirActSeqBinding->Value.InputAction].OlderState.GetHoldTime());
-					if (DirActSeqBinding->Value.bAutoConsume)
+					auto Value = InputBuffer.GetValue(ActionState.GetAssociatedFrame(), ActionSlot);
+					const auto Delegate = Entry->Binding.Delegate;
+					Delegate.Execute(Value, ActionState.GetHoldTime());
+					if (Handle.bAutoConsume)
 					{
-						ConsumeInput(DirActSeqBinding->Value.InputAction);
-						ConsumeInput(DirActSeqBinding->Value.DirectionalAction);
+						ConsumeInput(Handle.InputAction);
+						ConsumeInput(Handle.DirectionalAction);
 					}
 				}
 			}
 		}
 		else
 		{
-			IB_FLog(Error, "One Or Both Bound Actions Don't Exit In Buffer [1 - %s] & [2 - %s]", *DirActSeqBinding->Value.InputAction.ToString(), *DirActSeqBinding->Value.DirectionalAction.ToString())
+			IB_FLog(Error, "One Or Both Bound Actions Don't Exit In Buffer [1 - %s] & [2 - %s]", *Handle.InputAction.ToString(), *Handle.DirectionalAction.ToString())
 		}
 	}
 
 
 	/* Evaluate Button Seq Events */
-	for (auto ActionSeqBinding = ActionSeqDelegates.CreateIterator(); ActionSeqBinding; ++ActionSeqBinding)
+	ActionSeqDelegates.Gather(DirtyInputTags, GatheredBindings);
+	for (const FGatheredInputBinding& Gathered : GatheredBindings)
 	{
+		const auto* Entry = ActionSeqDelegates.Find(Gathered.ID);
+		if (!Entry || Entry->Order != Gathered.Order) continue;
+		
 		// If no binding for the delegate, skip and delete
-		if (!ActionSeqBinding->Key.Delegate.IsBound())
+		if (!Entry->Binding.Delegate.IsBound())
 		{
-			IB_FLog(Error, "Delegate In Action Bindings Not Bound [%s]", *ActionSeqBinding->Key.Delegate.GetFunctionName().ToString());
-			ActionSeqBinding.RemoveCurrent();
+			IB_FLog(Error, "Delegate In Action Bindings Not Bound [%s]", *Entry->Binding.Delegate.GetFunctionName().ToString());
+			ActionSeqDelegates.Remove(FButtonSequenceBinding(Entry->Binding));
 			continue;
 		}
-		
-		if (ButtonInputValidFrame.Contains(ActionSeqBinding->Value.FirstAction) && ButtonInputValidFrame.Contains(ActionSeqBinding->Value.SecondAction))
+
+		const FInputActionSequenceDelegateHandle Handle = Entry->Handle;
+		const int32 FirstSlot = GetActionSlot(Handle.FirstAction);
+		const int32 SecondSlot = GetActionSlot(Handle.SecondAction);
+		if (FirstSlot != INDEX_NONE && SecondSlot != INDEX_NONE)
 		{
 			// NOTE: Order doesn't matter here, but if we go with the tuple approach, we should guarantee first element is "older" than the second
-			const bool bRepeatedAction = (ActionSeqBinding->Value.FirstAction == (ActionSeqBinding->Value.SecondAction));
+			const bool bRepeatedAction = (FirstSlot == SecondSlot);
 
-			const auto FirstAction = ButtonInputValidFrame[ActionSeqBinding->Value.FirstAction].OlderState;
-			const auto SecondAction = bRepeatedAction ? ButtonInputValidFrame[ActionSeqBinding->Value.SecondAction].NewerState : ButtonInputValidFrame[ActionSeqBinding->Value.SecondAction].OlderState;
+			const auto FirstAction = ButtonInputValidFrame[FirstSlot].OlderState;
+			const auto SecondAction = bRepeatedAction ? ButtonInputValidFrame[SecondSlot].NewerState : ButtonInputValidFrame[SecondSlot].OlderState;
 
 			bool bInputStatesValid = false;
 			
-			if (ActionSeqBinding.Value().bFirstInputIsHold) // Check if first input is a hold and second input is a press that hasn't been consumed
+			if (Handle.bFirstInputIsHold) // Check if first input is a hold and second input is a press that hasn't been consumed
 			{
 				ensureMsgf(!bRepeatedAction, TEXT("INPUT BUFFER BINDING: bRepated action was true during event evaluation for action sequence that treats first input as hold!"));
-				bInputStatesValid = FirstAction.IsHold() && SecondAction.IsPress() && !IsInputConsumed(ActionSeqBinding->Value.SecondAction, false);
+				bInputStatesValid = FirstAction.IsHold() && SecondAction.IsPress() && !IsInputConsumed(SecondSlot, false);
 			}
 			else // Check both are pressed and both havent been consumed. If order matters, check execution order
 			{
-				bInputStatesValid = FirstAction.IsPress() && SecondAction.IsPress() && !(ActionSeqBinding->Value.bButtonOrderMatters && (FirstAction.GetAssociatedFrame() < SecondAction.GetAssociatedFrame()));
-				bInputStatesValid = bInputStatesValid && (!IsInputConsumed(ActionSeqBinding->Value.FirstAction) && !IsInputConsumed(ActionSeqBinding->Value.SecondAction, bRepeatedAction));
+				bInputStatesValid = FirstAction.IsPress() && SecondAction.IsPress() && !(Handle.bButtonOrderMatters && (FirstAction.GetAssociatedFrame() < SecondAction.GetAssociatedFrame()));
+				bInputStatesValid = bInputStatesValid && (!IsInputConsumed(FirstSlot) && !IsInputConsumed(SecondSlot, bRepeatedAction));
 			}
 
 			if (bInputStatesValid)
 			{
-				const FInputActionValue& FirstValue = InputBuffer[FirstAction.GetAssociatedFrame()].InputsFrameState[ActionSeqBinding->Value.FirstAction].Value;
-				const FInputActionValue& SecondValue = InputBuffer[FirstAction.GetAssociatedFrame()].InputsFrameState[ActionSeqBinding->Value.FirstAction].Value;
+				const FInputActionValue FirstValue = InputBuffer.GetValue(FirstAction.GetAssociatedFrame(), FirstSlot);
+				const FInputActionValue SecondValue = InputBuffer.GetValue(FirstAction.GetAssociatedFrame(), FirstSlot);
 
-				ActionSeqBinding->Key.Delegate.Execute(FirstValue, SecondValue); 
-				if (ActionSeqBinding->Value.bAutoConsume)
+				const auto Delegate = Entry->Binding.Delegate;
+				Delegate.Execute(FirstValue, SecondValue); 
+				if (Handle.bAutoConsume)
 				{
-					if (!ActionSeqBinding->Value.bFirstInputIsHold) // Only consume first action if it is not a hold
-						ConsumeInput(ActionSeqBinding->Value.FirstAction);
-					ConsumeInput(ActionSeqBinding->Value.SecondAction, bRepeatedAction);
+					if (!Handle.bFirstInputIsHold) // Only consume first action if it is not a hold
+						ConsumeInput(Handle.FirstAction);
+					ConsumeInput(Handle.SecondAction, bRepeatedAction);
 				}
 			}
 		}
 		else
 		{
-			IB_FLog(Error, "One Or Both Bound Actions Don't Exist In Buffer [1 - %s] & [2 - %s]", *ActionSeqBinding->Value.FirstAction.ToString(), *ActionSeqBinding->Value.SecondAction.ToString())
+			IB_FLog(Error, "One Or Both Bound Actions Don't Exist In Buffer [1 - %s] & [2 - %s]", *Handle.FirstAction.ToString(), *Handle.SecondAction.ToString())
 		}
 	}
 	
 	/* Evaluate Directional Events */
-	for (auto DirectionalBindings = DirectionalDelegates.CreateIterator(); DirectionalBindings; ++DirectionalBindings)
+	DirectionalDelegates.Gather(DirtyInputTags, GatheredBindings);
+	for (const FGatheredInputBinding& Gathered : GatheredBindings)
 	{
+		const auto* Entry = DirectionalDelegates.Find(Gathered.ID);
+		if (!Entry || Entry->Order != Gathered.Order) continue;
+		
 		// If no binding for the delegate, skip and delete
-		if (!DirectionalBindings->Key.Delegate.IsBound())
+		if (!Entry->Binding.Delegate.IsBound())
 		{
-			IB_FLog(Error, "Delegate In Action Bindings Not Bound [%s]", *DirectionalBindings->Key.Delegate.GetFunctionName().ToString());
-			DirectionalBindings.RemoveCurrent();
+			IB_FLog(Error, "Delegate In Action Bindings Not Bound [%s]", *Entry->Binding.Delegate.GetFunctionName().ToString());
+			DirectionalDelegates.Remove(FDirectionalBinding(Entry->Binding));
 			continue;
 		}
-		
-		if (DirectionalInputValidFrame.Contains(DirectionalBindings->Value.DirectionalAction))
+
+		const FDirectionalActionDelegateHandle Handle = Entry->Handle;
+		const int32 DirectionalSlot = GetDirectionalSlot(Handle.DirectionalAction);
+		if (DirectionalSlot != INDEX_NONE)
 		{
-			if (DirectionalInputValidFrame[DirectionalBindings->Value.DirectionalAction] >= 0)
+			if (DirectionalInputValidFrame[DirectionalSlot] >= 0)
 			{
-				DirectionalBindings->Key.Delegate.Execute();
-				if (DirectionalBindings->Value.bAutoConsume)
+				const auto Delegate = Entry->Binding.Delegate;
+				Delegate.Execute();
+				if (Handle.bAutoConsume)
 				{
-					ConsumeInput(DirectionalBindings->Value.DirectionalAction);
+					ConsumeInput(Handle.DirectionalAction);
 				}
 			}
 		}
 		else
 		{
-			IB_FLog(Error, "Bound Directional Action Doesn't Exist In Buffer [%s]", *DirectionalBindings->Value.DirectionalAction.ToString())
+			IB_FLog(Error, "Bound Directional Action Doesn't Exist In Buffer [%s]", *Handle.DirectionalAction.ToString())
 		}
 	}
 
 	/* Evaluate Action Events */
-	for (auto ActionBindings = ActionDelegates.CreateIterator(); ActionBindings; ++ActionBindings)
+	ActionDelegates.Gather(DirtyInputTags, GatheredBindings);
+	for (const FGatheredInputBinding& Gathered : GatheredBindings)
 	{
+		const auto* Entry = ActionDelegates.Find(Gathered.ID);
+		if (!Entry || Entry->Order != Gathered.Order) continue;
+		
 		// If no binding for the delegate, skip and delete
-		if (!ActionBindings->Key.Delegate.IsBound())
+		if (!Entry->Binding.Delegate.IsBound())
 		{
-			IB_FLog(Error, "Delegate In Action Bindings Not Bound [%s]", *ActionBindings->Key.Delegate.GetFunctionName().ToString());
-			ActionBindings.RemoveCurrent();
+			IB_FLog(Error, "Delegate In Action Bindings Not Bound [%s]", *Entry->Binding.Delegate.GetFunctionName().ToString());
+			ActionDelegates.Remove(FButtonBinding(Entry->Binding));
 			continue;
 		}
-		
-		if (ButtonInputValidFrame.Contains(ActionBindings->Value.InputAction))
+
+		const FInputActionDelegateHandle Handle = Entry->Handle;
+		const auto Delegate = Entry->Binding.Delegate;
+		const int32 Slot = GetActionSlot(Handle.InputAction);
+		if (Slot != INDEX_NONE)
 		{
-			switch (ActionBindings->Value.TriggerType)
+			FBufferStateTuple& ValidFrame = ButtonInputValidFrame[Slot];
+			switch (Handle.TriggerType)
 			{
 				case TRIGGER_Press:
-					if (ButtonInputValidFrame[ActionBindings->Value.InputAction].OlderState.IsPress() && !IsInputConsumed(ActionBindings->Value.InputAction))
+					if (ValidFrame.OlderState.IsPress() && !IsInputConsumed(Slot))
 					{
-						auto Value = InputBuffer[ButtonInputValidFrame[ActionBindings->Value.InputAction].OlderState.GetAssociatedFrame()].InputsFrameState[ActionBindings->Value.InputAction].Value;
-						ActionBindings->Key.Delegate.Execute(Value, 0);
-						if (ActionBindings->Value.bAutoConsume) // Only press knows what "consume" is
+						auto Value = InputBuffer.GetValue(ValidFrame.OlderState.GetAssociatedFrame(), Slot);
+						Delegate.Execute(Value, 0);
+						if (Handle.bAutoConsume) // Only press knows what "consume" is
 						{
-							ConsumeInput(ActionBindings->Value.InputAction);
+							ConsumeInput(Handle.InputAction);
 						}
 					}
 					break;
 				case TRIGGER_Hold:
-					if (ButtonInputValidFrame[ActionBindings->Value.InputAction].NewerState.IsHold()) // Newer input hold takes presedence as prev input was released and its hold invalidated
+					if (ValidFrame.NewerState.IsHold()) // Newer input hold takes presedence as prev input was released and its hold invalidated
 					{
-						auto Value = InputBuffer[ButtonInputValidFrame[ActionBindings->Value.InputAction].NewerState.GetAssociatedFrame()].InputsFrameState[ActionBindings->Value.InputAction].Value;
-						ActionBindings->Key.Delegate.Execute(Value, ButtonInputValidFrame[ActionBindings->Value.InputAction].NewerState.GetHoldTime());
+						auto Value = InputBuffer.GetValue(ValidFrame.NewerState.GetAssociatedFrame(), Slot);
+						Delegate.Execute(Value, ValidFrame.NewerState.GetHoldTime());
 					}
-					else if (ButtonInputValidFrame[ActionBindings->Value.InputAction].OlderState.IsHold())
+					else if (ValidFrame.OlderState.IsHold())
 					{
-						auto Value = InputBuffer[ButtonInputValidFrame[ActionBindings->Value.InputAction].OlderState.GetAssociatedFrame()].InputsFrameState[ActionBindings->Value.InputAction].Value;
-						ActionBindings->Key.Delegate.Execute(Value, ButtonInputValidFrame[ActionBindings->Value.InputAction].OlderState.GetHoldTime());
+						auto Value = InputBuffer.GetValue(ValidFrame.OlderState.GetAssociatedFrame(), Slot);
+						Delegate.Execute(Value, ValidFrame.OlderState.GetHoldTime());
 					}
 					break;
 				case TRIGGER_Release:
-					if (ButtonInputValidFrame[ActionBindings->Value.InputAction].NewerState.IsRelease())
+					if (ValidFrame.NewerState.IsRelease())
 					{
-						if (InputBuffer[ButtonInputValidFrame[ActionBindings->Value.InputAction].NewerState.GetAssociatedFrame()].InputsFrameState[ActionBindings->Value.InputAction].bReleaseFlagged) continue;
-						ActionBindings->Key.Delegate.Execute(FInputActionValue(), -ButtonInputValidFrame[ActionBindings->Value.InputAction].NewerState.GetHoldTime());
-						InputBuffer[ButtonInputValidFrame[ActionBindings->Value.InputAction].NewerState.GetAssociatedFrame()].InputsFrameState[ActionBindings->Value.InputAction].bReleaseFlagged = true;
+						const int8 ReleaseFrame = ValidFrame.NewerState.GetAssociatedFrame();
+						if (InputBuffer.IsReleaseFlagged(ReleaseFrame, Slot)) continue;
+						InputBuffer.SetReleaseFlagged(ReleaseFrame, Slot, true);
+						Delegate.Execute(FInputActionValue(), -ValidFrame.NewerState.GetHoldTime());
 					}
-					else if (ButtonInputValidFrame[ActionBindings->Value.InputAction].OlderState.IsRelease())
+					else if (ValidFrame.OlderState.IsRelease())
 					{
-						if (InputBuffer[ButtonInputValidFrame[ActionBindings->Value.InputAction].OlderState.GetAssociatedFrame()].InputsFrameState[ActionBindings->Value.InputAction].bReleaseFlagged) continue;
-						ActionBindings->Key.Delegate.Execute(FInputActionValue(), -ButtonInputValidFrame[ActionBindings->Value.InputAction].OlderState.GetHoldTime());
-						InputBuffer[ButtonInputValidFrame[ActionBindings->Value.InputAction].OlderState.GetAssociatedFrame()].InputsFrameState[ActionBindings->Value.InputAction].bReleaseFlagged = true;
+						const int8 ReleaseFrame = ValidFrame.OlderState.GetAssociatedFrame();
+						if (InputBuffer.IsReleaseFlagged(ReleaseFrame, Slot)) continue;
+						InputBuffer.SetReleaseFlagged(ReleaseFrame, Slot, true);
+						Delegate.Execute(FInputActionValue(), -ValidFrame.OlderState.GetHoldTime());
 					}
 					break;
 				default:;
@@ -432,7 +957,7 @@ void UInputBufferSubsystem::EvaluateEvents()
 		}
 		else
 		{
-			IB_FLog(Error, "Bound Action Doesn't Exist In Buffer [%s]", *ActionBindings->Value.InputAction.ToString())
+			IB_FLog(Error, "Bound Action Doesn't Exist In Buffer [%s]", *Handle.InputAction.ToString())
 		}
 	}
 }
@@ -440,131 +965,138 @@ void UInputBufferSubsystem::EvaluateEvents()
 // Can only really consume press events
 bool UInputBufferSubsystem::ConsumeInput(const FGameplayTag& InputID, bool bConsumeNewer)
 {
-	if (!ButtonInputValidFrame.Contains(InputID) && !DirectionalInputValidFrame.Contains(InputID))
+	const int32 Slot = GetActionSlot(InputID);
+	const int32 DirectionalSlot = Slot == INDEX_NONE ? GetDirectionalSlot(InputID) : INDEX_NONE;
+	if (Slot == INDEX_NONE && DirectionalSlot == INDEX_NONE)
 	{
 		IB_FLog(Error, "%s - Input Action Registered But Not Collected In Buffer", *InputID.ToString())
 		return false;
 	}
 
-	if (InputID.MatchesTag(TAG_Input_Button) || InputID.MatchesTag(TAG_Input_Axis))
+	if (Slot != INDEX_NONE)
 	{
+		FBufferStateTuple& ValidFrame = ButtonInputValidFrame[Slot];
+		
 		// NOTE: We reset the states here because ButtonInputValidFrame won't be updated until the next buffer update (fixed tick interval), but EvalEvents has no fixed interval so we wanna avoid invoking the same event multiple times within a buffer-tick
-		if (ButtonInputValidFrame[InputID].OlderState.IsPress() && !bConsumeNewer) // Check older input first
+		if (ValidFrame.OlderState.IsPress() && !bConsumeNewer) // Check older input first
 		{
-			InputBuffer[ButtonInputValidFrame[InputID].OlderState.GetAssociatedFrame()].InputsFrameState[InputID].bUsed = true;
-			PropagateConsume(InputID, ButtonInputValidFrame[InputID].OlderState.GetAssociatedFrame());
-			ButtonInputValidFrame[InputID].OlderState.Reset();
+			PropagateConsume(Slot, ValidFrame.OlderState.GetAssociatedFrame());
+			ValidFrame.OlderState.Reset();
 			return true;
 		}
-		if (ButtonInputValidFrame[InputID].NewerState.IsPress()) // Now check newer input if older wasn't valid
+		if (ValidFrame.NewerState.IsPress()) // Now check newer input if older wasn't valid
 		{
-			InputBuffer[ButtonInputValidFrame[InputID].NewerState.GetAssociatedFrame()].InputsFrameState[InputID].bUsed = true;
-			PropagateConsume(InputID, ButtonInputValidFrame[InputID].NewerState.GetAssociatedFrame());
-			ButtonInputValidFrame[InputID].NewerState.Reset();
+			PropagateConsume(Slot, ValidFrame.NewerState.GetAssociatedFrame());
+			ValidFrame.NewerState.Reset();
 			return true;
 		}
 	}
-	else if (InputID.MatchesTag(TAG_Input_Directional))
+	else
 	{
-		if (DirectionalInputValidFrame[InputID] < 0) return false;
-		if (InputBuffer[DirectionalInputValidFrame[InputID]].InputsFrameState.Contains(InputID))
-		{
-			for (int frame = BUFFER_SIZE; frame >= DirectionalInputValidFrame[InputID]; frame--)
-			{
-				InputBuffer[frame].InputsFrameState[InputID].Value = 0;
-			}
-			DirectionalInputValidFrame[InputID] = -1;
-			return true;
-		}
+		// Directionals don't own a column in the buffer frames (they're evaluated off the directional axis), so the frames up to
+		// the consumed match are left out of the directional's evaluation until they leave the buffer
+		if (DirectionalInputValidFrame[DirectionalSlot] < 0) return false;
+		DirectionalUnconsumedFrames[DirectionalSlot] = DirectionalInputValidFrame[DirectionalSlot];
+		DirectionalInputValidFrame[DirectionalSlot] = -1;
+		return true;
 	}
 	return false;
 }
 
 bool UInputBufferSubsystem::IsConsumedInputHeld(const FGameplayTag& InputID) const
 {
-	if (!ButtonInputValidFrame.Contains(InputID))
+	const int32 Slot = GetActionSlot(InputID);
+	if (Slot == INDEX_NONE)
 	{
 		IB_FLog(Error, "%s - Input Action Registered But Not Collected In Buffer", *InputID.ToString())
 		return false;
 	}
 
-	const auto InputState = InputBuffer.Front().InputsFrameState[InputID];
-
-	return InputState.bUsed && InputState.HoldTime > 0;
+	return InputBuffer.IsUsed(0, Slot) && InputBuffer.GetHoldTime(0, Slot) > 0;
 }
 
 float UInputBufferSubsystem::GetTimeInputHeld(const FGameplayTag& InputID) const
 {
-	if (!ButtonInputValidFrame.Contains(InputID))
+	const int32 Slot = GetActionSlot(InputID);
+	if (Slot == INDEX_NONE)
 	{
 		IB_FLog(Error, "%s - Input Action Registered But Not Collected In Buffer", *InputID.ToString())
 		return false;
 	}
 
-	const auto InputState = InputBuffer.Front().InputsFrameState[InputID];
-
-	return InputState.HoldTime * TICK_INTERVAL;
+	return InputBuffer.GetHoldTime(0, Slot) * TICK_INTERVAL;
 }
 
 bool UInputBufferSubsystem::CanPressInput(const FGameplayTag& InputID)
 {
-	if (!ButtonInputValidFrame.Contains(InputID))
+	const int32 Slot = GetActionSlot(InputID);
+	if (Slot == INDEX_NONE)
 	{
 		IB_FLog(Error, "%s - Input Action Registered But Not Collected In Buffer", *InputID.ToString())
 		return false;
 	}
 
-	return ButtonInputValidFrame[InputID].IsEitherPress();
+	return ButtonInputValidFrame[Slot].IsEitherPress();
 }
 
-bool UInputBufferSubsystem::IsInputConsumed(const FGameplayTag& InputID, bool bCheckNewer)
+bool UInputBufferSubsystem::IsInputConsumed(const int32 Slot, bool bCheckNewer)
 {
-	if (!ButtonInputValidFrame.Contains(InputID))
+	if (!ButtonInputValidFrame.IsValidIndex(Slot))
 	{
-		IB_FLog(Error, "%s - Input Action Registered But Not Collected In Buffer", *InputID.ToString())
+		IB_FLog(Error, "[%d] - Input Action Slot Not Collected In Buffer", Slot)
 		return false;
 	}
 	
 	if (!bCheckNewer) // Check older input first
 	{
-		return InputBuffer[ButtonInputValidFrame[InputID].OlderState.GetAssociatedFrame()].InputsFrameState[InputID].bUsed;
+		const int8 OlderFrame = ButtonInputValidFrame[Slot].OlderState.GetAssociatedFrame();
+		return OlderFrame >= 0 && IsFrameConsumed(OlderFrame, Slot);
 	}
-	if (ButtonInputValidFrame[InputID].NewerState.IsPress()) // Now check newer input if older wasn't valid
+	if (ButtonInputValidFrame[Slot].NewerState.IsPress()) // Now check newer input if older wasn't valid
 	{
-		return InputBuffer[ButtonInputValidFrame[InputID].NewerState.GetAssociatedFrame()].InputsFrameState[InputID].bUsed;
+		return IsFrameConsumed(ButtonInputValidFrame[Slot].NewerState.GetAssociatedFrame(), Slot);
 	}
 	
 	return false;
 }
 
-void UInputBufferSubsystem::PropagateConsume(const FGameplayTag& InputID, const uint8 FromFrame)
+void UInputBufferSubsystem::PropagateConsume(const int32 Slot, const uint8 FromFrame)
 {
+	if (IsWindowTracked())
+	{
+		/* Consumed frames are marked in one mask operation. Their per frame flags are still set, the front frame's carries over into the
+		   next frame and the others are read once their frame ages out of the tracker's window (IsFrameConsumed on frames >= 64) */
+		uint64 ConsumedFrames = ButtonFrameTrackers[Slot].Consume(FromFrame);
+		while (ConsumedFrames)
+		{
+			InputBuffer.SetUsed(static_cast<int32>(FMath::CountTrailingZeros64(ConsumedFrames)), Slot, true);
+			ConsumedFrames &= ConsumedFrames - 1;
+		}
+		return;
+	}
+	
 	for (int frame = FromFrame; frame >= 0; frame--)
 	{
-		if (InputBuffer[frame].InputsFrameState[InputID].HoldTime == -1) return;
-		InputBuffer[frame].InputsFrameState[InputID].bUsed = true;
+		if (InputBuffer.GetHoldTime(frame, Slot) < 0) return;
+		InputBuffer.SetUsed(frame, Slot, true);
 	}
 }
 
 
-void UInputBufferSubsystem::ProcessDirectionVector(const FVector2D& DirectionInputVector, FVector& ProcessedInputVector, FVector& OutPlayerForward, FVector& OutPlayerRight) const
+bool UInputBufferSubsystem::ComputeDirectionalBasis(FVector& OutInputForward, FVector& OutInputRight, FVector& OutPlayerForward, FVector& OutPlayerRight) const
 {
-	const auto Controller = GetLocalPlayer<ULocalPlayer>()->GetPlayerController(GetWorld());
+	const ULocalPlayer* LocalPlayer = GetLocalPlayer<ULocalPlayer>();
+	const auto Controller = LocalPlayer ? LocalPlayer->GetPlayerController(GetWorld()) : nullptr;
+	const auto Owner = Controller ? Controller->GetPawn() : nullptr;
 	
-	if (Controller != nullptr)
-	{
-		//Controller->GetPawn()->GetLastMovementInputVector();
-		const FQuat InputRotation = UCoreMathLibrary::ComputeRelativeInputVector(Controller->GetPawn());
-		const FVector ForwardDirection = InputRotation.GetForwardVector();
-		const FVector RightDirection = InputRotation.GetRightVector();
-
-		ProcessedInputVector = ForwardDirection * DirectionInputVector.Y + RightDirection * DirectionInputVector.X;
-		if (const auto Owner = Controller->GetPawn())
-		{
-			OutPlayerForward = Owner->GetActorForwardVector();
-			OutPlayerRight = Owner->GetActorRightVector();
-		}
-	}
+	if (Owner == nullptr) return false;
+	
+	const FQuat InputRotation = UCoreMathLibrary::ComputeRelativeInputVector(Owner);
+	OutInputForward = InputRotation.GetForwardVector();
+	OutInputRight = InputRotation.GetRightVector();
+	OutPlayerForward = Owner->GetActorForwardVector();
+	OutPlayerRight = Owner->GetActorRightVector();
+	return true;
 }
 
 
@@ -581,9 +1113,9 @@ void UInputBufferSubsystem::DisplayDebug(UCanvas* Canvas, const FDebugDisplayInf
 	
 	/* Draw Buffer Oldest Frame Vals*/
 	FString InputFrames = "";
-	for (auto ID : InputMap->GetActionIDs())
+	for (const auto& State : ButtonInputValidFrame)
 	{
-		InputFrames += FString::FromInt(ButtonInputValidFrame[ID].NewerState.IsHold() ? ButtonInputValidFrame[ID].NewerState.GetHoldTime() : ButtonInputValidFrame[ID].OlderState.GetHoldTime());
+		InputFrames += FString::FromInt(State.NewerState.IsHold() ? State.NewerState.GetHoldTime() : State.OlderState.GetHoldTime());
 		InputFrames += "            ";
 	}
 	DisplayDebugManager.SetDrawColor(FColor::Red);
@@ -593,7 +1125,7 @@ void UInputBufferSubsystem::DisplayDebug(UCanvas* Canvas, const FDebugDisplayInf
 	/* Write the input names on the first row */
 	float YPosD = DisplayDebugManager.GetYPos();
 	FString InputNames = "";
-	for (auto ID : InputMap->GetActionIDs())
+	for (auto ID : SlotActionIDs)
 	{
 		//FText InputName = Mapping.Action->ActionDescription;
 		InputNames += ID.ToString();
@@ -621,11 +1153,11 @@ void UInputBufferSubsystem::DisplayDebug(UCanvas* Canvas, const FDebugDisplayInf
 
 		XOffset += j * 12.f * DisplayDebugManager.GetMaxCharHeight() * 0.75f;
 		
-		ButtonStates = "(Consumed) " + FString::FromInt(State.Value.NewerState.IsConsumed());
+		ButtonStates = "(Consumed) " + FString::FromInt(State.NewerState.IsConsumed());
 		DisplayDebugManager.DrawString(ButtonStates, XOffset);
-		ButtonStates = "(Frame) " + FString::FromInt(State.Value.NewerState.GetAssociatedFrame());
+		ButtonStates = "(Frame) " + FString::FromInt(State.NewerState.GetAssociatedFrame());
 		DisplayDebugManager.DrawString(ButtonStates, XOffset);
-		ButtonStates = "(HoldTime) " + FString::FromInt(State.Value.NewerState.GetHoldTime());
+		ButtonStates = "(HoldTime) " + FString::FromInt(State.NewerState.GetHoldTime());
 		DisplayDebugManager.DrawString(ButtonStates, XOffset);
 		j++;
 	}
@@ -650,11 +1182,11 @@ void UInputBufferSubsystem::DisplayDebug(UCanvas* Canvas, const FDebugDisplayInf
 
 		XOffset += j * 12.f * DisplayDebugManager.GetMaxCharHeight() * 0.75f;
 		
-		ButtonStates = "(Consumed) " + FString::FromInt(State.Value.OlderState.IsConsumed());
+		ButtonStates = "(Consumed) " + FString::FromInt(State.OlderState.IsConsumed());
 		DisplayDebugManager.DrawString(ButtonStates, XOffset);
-		ButtonStates = "(Frame) " + FString::FromInt(State.Value.OlderState.GetAssociatedFrame());
+		ButtonStates = "(Frame) " + FString::FromInt(State.OlderState.GetAssociatedFrame());
 		DisplayDebugManager.DrawString(ButtonStates, XOffset);
-		ButtonStates = "(HoldTime) " + FString::FromInt(State.Value.OlderState.GetHoldTime());
+		ButtonStates = "(HoldTime) " + FString::FromInt(State.OlderState.GetHoldTime());
 		DisplayDebugManager.DrawString(ButtonStates, XOffset);
 		j++;
 	}
@@ -670,12 +1202,11 @@ void UInputBufferSubsystem::DisplayDebug(UCanvas* Canvas, const FDebugDisplayInf
 	{
 		if (i >= BUTTON_BUFFER_SIZE) DisplayDebugManager.SetDrawColor(FColor::Red);
 		
-		auto BufferRow = InputBuffer[i].InputsFrameState;
 		FString BufferRowText = "";
-		for (auto InputID : InputMap->GetActionIDs())
+		for (int32 Slot = 0; Slot < InputBuffer.NumSlots(); Slot++)
 		{
-			BufferRowText += FString::FromInt(BufferRow[InputID].HoldTime);
-			if (BufferRow[InputID].bUsed) BufferRowText += ">";
+			BufferRowText += FString::FromInt(InputBuffer.GetHoldTime(i, Slot));
+			if (IsFrameConsumed(i, Slot)) BufferRowText += ">";
 			BufferRowText += "            "; // Spacing
 		}
 		DisplayDebugManager.DrawString(BufferRowText);
@@ -685,7 +1216,7 @@ void UInputBufferSubsystem::DisplayDebug(UCanvas* Canvas, const FDebugDisplayInf
 	DisplayDebugManager.SetDrawColor(FColor::Yellow);
 	float largestString = 0;
 	FString DirectionalIDs = "";
-	for (auto InputID : InputMap->GetDirectionalIDs())
+	for (const FGameplayTag& InputID : SlotDirectionalIDs)
 	{
 		if (InputID.ToString().Len() > largestString) largestString = InputID.ToString().Len();
 		DirectionalIDs = InputID.ToString();
@@ -700,7 +1231,8 @@ void UInputBufferSubsystem::DisplayDebug(UCanvas* Canvas, const FDebugDisplayInf
 	FString DirectionalValues = "";	
 	for (const auto DirectionalAction : InputMap->DirectionalActionMap->GetMappings())
 	{
-		DirectionalValues = FString::FromInt(DirectionalInputValidFrame[DirectionalAction->GetID()]);
+		const int32 DirectionalSlot = GetDirectionalSlot(DirectionalAction->GetID());
+		DirectionalValues = DirectionalSlot != INDEX_NONE ? FString::FromInt(DirectionalInputValidFrame[DirectionalSlot]) : TEXT("-");
 		if (DirectionalAction->bAngleChange) DirectionalValues += "     " + FString::SanitizeFloat(DirectionalAction->CurAngle);
 		DisplayDebugManager.DrawString(DirectionalValues, XOffset);
 	}
@@ -0,0 +1,706 @@
+// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+#include "Subsystems/RadicalMovementSubsystem.h"
+#include "RadicalMovementComponent.h"
+#include "RadicalCharacter.h"
+#include "GameFramework/Character.h"
+#include "Async/ParallelFor.h"
+
+#pragma region Profiling & CVars
+DECLARE_CYCLE_STAT(TEXT("Batched Movement Tick"), STAT_BatchTick, STATGROUP_RadicalMovementComp)
+DECLARE_CYCLE_STAT(TEXT("Batch Pre Tick"), STAT_BatchPreTick, STATGROUP_RadicalMovementComp)
+DECLARE_CYCLE_STAT(TEXT("Batch Move"), STAT_BatchMove, STATGROUP_RadicalMovementComp)
+DECLARE_CYCLE_STAT(TEXT("Batch Integrate"), STAT_BatchIntegrate, STATGROUP_RadicalMovementComp)
+DECLARE_CYCLE_STAT(TEXT("Batch Post Tick"), STAT_BatchPostTick, STATGROUP_RadicalMovementComp)
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Batched Components"), STAT_NumBatchedComponents, STATGROUP_RadicalMovementComp)
+DECLARE_CYCLE_STAT(TEXT("Pawn Repulsion"), STAT_PawnRepulsion, STATGROUP_RadicalMovementComp)
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Repulsion Pawns"), STAT_NumRepulsionPawns, STATGROUP_RadicalMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Movement Base Cache Hits"), STAT_MovementBaseCacheHits, STATGROUP_RadicalMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Movement Base Cache Misses"), STAT_MovementBaseCacheMisses, STATGROUP_RadicalMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Movement Base Delta Hits"), STAT_MovementBaseDeltaHits, STATGROUP_RadicalMovementComp)
+
+namespace RMCCVars
+{
+	int32 BatchedMovement = 0;
+	FAutoConsoleVariableRef CVarBatchedMovement
+	(
+		TEXT("rmc.BatchedMovement"),
+		BatchedMovement,
+		TEXT("Tick movement components together through the RadicalMovementSubsystem instead of one tick function each. Applies to components beginning play after it is set. 0: Disable, 1: Enable"),
+		ECVF_Default
+	);
+
+	int32 BatchedMovementParallelThreshold = 32;
+	FAutoConsoleVariableRef CVarBatchedMovementParallelThreshold
+	(
+		TEXT("rmc.BatchedMovement.ParallelThreshold"),
+		BatchedMovementParallelThreshold,
+		TEXT("Min number of batched components before the parallel phases of the batch are spread across worker threads."),
+		ECVF_Default
+	);
+
+	int32 PawnRepulsion = 1;
+	FAutoConsoleVariableRef CVarPawnRepulsion
+	(
+		TEXT("rmc.PawnRepulsion"),
+		PawnRepulsion,
+		TEXT("Solve the repulsion between pawns with bEnablePawnRepulsion. 0: Disable, 1: Enable"),
+		ECVF_Default
+	);
+
+	int32 PawnRepulsionParallelThreshold = 64;
+	FAutoConsoleVariableRef CVarPawnRepulsionParallelThreshold
+	(
+		TEXT("rmc.PawnRepulsion.ParallelThreshold"),
+		PawnRepulsionParallelThreshold,
+		TEXT("Min number of repulsion pawns before the repulsion is solved across worker threads."),
+		ECVF_Default
+	);
+
+	int32 MovementBaseCache = 1;
+	FAutoConsoleVariableRef CVarMovementBaseCache
+	(
+		TEXT("rmc.MovementBaseCache"),
+		MovementBaseCache,
+		TEXT("Share the transform & velocities of movement bases between the pawns based on them each frame. 0: Disable, 1: Enable"),
+		ECVF_Default
+	);
+}
+#pragma endregion Profiling & CVars
+
+void FRadicalMovementBatchTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (IsValid(Target) && TickType != LEVELTICK_ViewportsOnly)
+	{
+		Target->TickBatch(DeltaTime, TickType);
+	}
+}
+
+FString FRadicalMovementBatchTickFunction::DiagnosticMessage()
+{
+	return TEXT("URadicalMovementSubsystem::TickBatch");
+}
+
+void URadicalMovementSubsystem::Deinitialize()
+{
+	if (BatchTickFunction.IsTickFunctionRegistered())
+	{
+		BatchTickFunction.UnRegisterTickFunction();
+	}
+
+	for (URadicalMovementComponent* Component : Components)
+	{
+		if (Component) Component->bMovementBatched = false;
+	}
+	Components.Empty();
+	States.Empty();
+	VelocityLanes = FRadicalMovementVelocityLanes();
+	VelocityRuns.Empty();
+	VelocityJobs.Empty();
+	BaseDependencies.Empty();
+
+	for (URadicalMovementComponent* Component : RepulsionComponents)
+	{
+		if (Component) Component->RepulsionIndex = INDEX_NONE;
+	}
+	RepulsionComponents.Empty();
+	RepulsionEntries.Empty();
+	RepulsionResults.Empty();
+	RepulsionCellEntries.Empty();
+	RepulsionCells.Empty();
+	MovementBaseCache.Empty();
+
+	Super::Deinitialize();
+}
+
+bool URadicalMovementSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool URadicalMovementSubsystem::IsBatchingEnabled()
+{
+	return RMCCVars::BatchedMovement > 0;
+}
+
+bool URadicalMovementSubsystem::RegisterComponent(URadicalMovementComponent* Component)
+{
+	UWorld* World = GetWorld();
+	if (!Component || Component->bMovementBatched || !World || !World->PersistentLevel)
+	{
+		return false;
+	}
+
+	if (!BatchTickFunction.IsTickFunctionRegistered())
+	{
+		// Same group as the component ticks it replaces, high priority so it runs ahead of the meshes waiting on it
+		BatchTickFunction.bCanEverTick = true;
+		BatchTickFunction.bHighPriority = true;
+		BatchTickFunction.TickGroup = TG_PrePhysics;
+		BatchTickFunction.Target = this;
+		BatchTickFunction.RegisterTickFunction(World->PersistentLevel);
+	}
+
+	Components.Add(Component);
+	States.AddDefaulted();
+
+	Component->bMovementBatched = true;
+	Component->SetComponentTickEnabled(false);
+
+	// Prerequisites on the component's own tick function are ignored now that it's disabled, move them over to the batch
+	if (Component->CharacterOwner)
+	{
+		USkeletalMeshComponent* Mesh = Component->CharacterOwner->GetMesh();
+		if (Mesh && Mesh->PrimaryComponentTick.bCanEverTick)
+		{
+			Mesh->PrimaryComponentTick.AddPrerequisite(this, BatchTickFunction);
+		}
+	}
+
+	UPrimitiveComponent* MovementBase = Component->GetMovementBase();
+	if (MovementBase && !MovementBaseUtility::IsSimulatedBase(MovementBase))
+	{
+		MovementBaseUtility::RemoveTickDependency(Component->PrimaryComponentTick, MovementBase);
+		AddBaseTickDependency(MovementBase);
+	}
+
+	return true;
+}
+
+void URadicalMovementSubsystem::UnregisterComponent(URadicalMovementComponent* Component)
+{
+	const int32 Index = Component ? Components.Find(Component) : INDEX_NONE;
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	Component->bMovementBatched = false;
+
+	if (Component->CharacterOwner)
+	{
+		if (USkeletalMeshComponent* Mesh = Component->CharacterOwner->GetMesh())
+		{
+			Mesh->PrimaryComponentTick.RemovePrerequisite(this, BatchTickFunction);
+		}
+	}
+
+	UPrimitiveComponent* MovementBase = Component->GetMovementBase();
+	if (MovementBase && !MovementBaseUtility::IsSimulatedBase(MovementBase))
+	{
+		RemoveBaseTickDependency(MovementBase);
+		MovementBaseUtility::AddTickDependency(Component->PrimaryComponentTick, MovementBase);
+	}
+
+	if (Component->IsActive())
+	{
+		Component->SetComponentTickEnabled(true);
+	}
+
+	// Don't shuffle the arrays while the batch is iterating them
+	if (bTickingBatch)
+	{
+		Components[Index] = nullptr;
+		States[Index].bMoved = false;
+		bPendingCompaction = true;
+	}
+	else
+	{
+		Components.RemoveAtSwap(Index);
+		States.RemoveAtSwap(Index);
+	}
+}
+
+void URadicalMovementSubsystem::AddBaseTickDependency(UPrimitiveComponent* MovementBase)
+{
+	if (!MovementBase || !MovementBaseUtility::UseRelativeLocation(MovementBase))
+	{
+		return;
+	}
+
+	int32& NumDependents = BaseDependencies.FindOrAdd(MovementBase);
+	if (NumDependents++ == 0)
+	{
+		MovementBaseUtility::AddTickDependency(BatchTickFunction, MovementBase);
+	}
+}
+
+void URadicalMovementSubsystem::RemoveBaseTickDependency(UPrimitiveComponent* MovementBase)
+{
+	int32* NumDependents = MovementBase ? BaseDependencies.Find(MovementBase) : nullptr;
+	if (!NumDependents)
+	{
+		return;
+	}
+
+	if (--(*NumDependents) <= 0)
+	{
+		BaseDependencies.Remove(MovementBase);
+		MovementBaseUtility::RemoveTickDependency(BatchTickFunction, MovementBase);
+	}
+}
+
+void URadicalMovementSubsystem::TickBatch(float DeltaTime, ELevelTick TickType)
+{
+	SCOPED_NAMED_EVENT(URadicalMovementSubsystem_TickBatch, FColor::Yellow)
+	SCOPE_CYCLE_COUNTER(STAT_BatchTick)
+	SET_DWORD_STAT(STAT_NumBatchedComponents, Components.Num());
+
+	bTickingBatch = true;
+
+	// Components registering during the batch (e.g spawned by movement events) start ticking next frame. States is only ever accessed
+	// by index here since a registration can grow it from within any of the component calls below
+	const int32 NumComponents = Components.Num();
+
+	/* Pre Tick: Input & skip checks, gathers the state the later phases work with */
+	{
+		SCOPE_CYCLE_COUNTER(STAT_BatchPreTick)
+		VelocityRuns.Reset();
+		for (int32 Index = 0; Index < NumComponents; Index++)
+		{
+			States[Index].bMoved = false;
+			States[Index].VelocityRun = INDEX_NONE;
+
+			URadicalMovementComponent* Component = Components[Index];
+			if (!IsValid(Component) || !Component->IsRegistered() || !Component->IsActive())
+			{
+				continue;
+			}
+
+			const AActor* Owner = Component->GetOwner();
+			float ComponentDeltaTime = DeltaTime * (Owner ? Owner->CustomTimeDilation : 1.f);
+			if (!Component->ConsumeMovementLODTime(ComponentDeltaTime))
+			{
+				continue;
+			}
+
+			const FVector OldVelocity = Component->Velocity;
+
+			if (!Component->PreTickMovement(ComponentDeltaTime, TickType, &Component->PrimaryComponentTick))
+			{
+				continue;
+			}
+
+			FRadicalMovementBatchState& State = States[Index];
+			State.DeltaTime = ComponentDeltaTime;
+			State.OldVelocity = OldVelocity;
+			State.OldRootLocation = Component->UpdatedComponent->GetComponentLocation();
+			State.bMoved = true;
+			if (Component->GatherBatchedVelocity(ComponentDeltaTime))
+			{
+				AddBatchedVelocity(Index);
+			}
+		}
+	}
+
+	/* Integrate: Velocity math over the gathered inputs, only touches each component's batched velocity */
+	{
+		SCOPE_CYCLE_COUNTER(STAT_BatchIntegrate)
+		IntegrateBatchedVelocities(NumComponents);
+	}
+
+	/* Move: Collision dependent, stays on the game thread */
+	{
+		SCOPE_CYCLE_COUNTER(STAT_BatchMove)
+		for (int32 Index = 0; Index < NumComponents; Index++)
+		{
+			URadicalMovementComponent* Component = Components[Index];
+			if (!States[Index].bMoved || !Component)
+			{
+				continue;
+			}
+
+			const float SimulatedTime = Component->SimulateMovement(States[Index].DeltaTime);
+			if (SimulatedTime != 0.f)
+			{
+				Component->PhysicalAcceleration = (Component->Velocity - States[Index].OldVelocity) / SimulatedTime;
+			}
+			
+			// Unused if the update never got to calculate its velocity (e.g no fixed step this frame)
+			if (States[Index].VelocityRun != INDEX_NONE && Component->BatchedVelocity.bUsed)
+			{
+				NumBatchedVelocitiesUsed++;
+			}
+			Component->BatchedVelocity.bValid = false;
+		}
+	}
+
+	/* Post Tick: Physics interactions & debug */
+	{
+		SCOPE_CYCLE_COUNTER(STAT_BatchPostTick)
+		for (int32 Index = 0; Index < NumComponents; Index++)
+		{
+			URadicalMovementComponent* Component = Components[Index];
+			if (!States[Index].bMoved || !Component)
+			{
+				continue;
+			}
+
+			const FRadicalMovementBatchState State = States[Index];
+			Component->PostTickMovement(State.DeltaTime, State.OldRootLocation);
+		}
+	}
+
+	bTickingBatch = false;
+
+	if (bPendingCompaction)
+	{
+		CompactComponents();
+	}
+}
+
+void URadicalMovementSubsystem::AddBatchedVelocity(int32 Index)
+{
+	const URadicalMovementComponent* Component = Components[Index];
+	const UMovementData* Data = Component->MovementData;
+	const float DeltaTime = Component->BatchedVelocity.DeltaTime;
+
+	// Only a handful of velocity models are in play at once (usually one per character archetype), so the runs are searched linearly
+	int32 Run = VelocityRuns.IndexOfByPredicate([Data, DeltaTime](const FRadicalMovementVelocityRun& Other)
+	{
+		return Other.DeltaTime == DeltaTime && Data->HasSameVelocityModel(Other.Data);
+	});
+	
+	if (Run == INDEX_NONE)
+	{
+		Run = VelocityRuns.Add({ Data, DeltaTime, 0, 0 });
+	}
+	
+	VelocityRuns[Run].Num++;
+	States[Index].VelocityRun = Run;
+}
+
+void URadicalMovementSubsystem::IntegrateBatchedVelocities(int32 NumComponents)
+{
+	/* Gather: Lanes are laid out run after run, each run's count is rebuilt as it's filled */
+	int32 NumLanes = 0;
+	for (FRadicalMovementVelocityRun& Run : VelocityRuns)
+	{
+		Run.Start = NumLanes;
+		NumLanes += Run.Num;
+		Run.Num = 0;
+	}
+	
+	VelocityLanes.SetNum(NumLanes);
+	for (int32 Index = 0; Index < NumComponents; Index++)
+	{
+		if (States[Index].VelocityRun == INDEX_NONE)
+		{
+			continue;
+		}
+
+		FRadicalMovementVelocityRun& Run = VelocityRuns[States[Index].VelocityRun];
+		const int32 Lane = Run.Start + Run.Num++;
+		const URadicalMovementComponent::FBatchedVelocity& Gathered = Components[Index]->BatchedVelocity;
+		VelocityLanes.Velocities[Lane] = Gathered.Velocity;
+		VelocityLanes.Accelerations[Lane] = Gathered.Acceleration;
+		VelocityLanes.Gravities[Lane] = Gathered.Gravity;
+		VelocityLanes.GravityDirs[Lane] = Gathered.GravityDir;
+		VelocityLanes.TerminalVelocities[Lane] = Gathered.TerminalVelocity;
+		VelocityLanes.MovementStates[Lane] = Gathered.MovementState;
+		VelocityLanes.Components[Lane] = Index;
+	}
+	NumBatchedVelocitiesGathered += NumLanes;
+
+	/* Integrate: Runs are split into jobs so large crowds sharing a model still spread across worker threads */
+	VelocityJobs.Reset();
+	for (const FRadicalMovementVelocityRun& Run : VelocityRuns)
+	{
+		for (int32 Offset = 0; Offset < Run.Num; Offset += VelocityJobSize)
+		{
+			VelocityJobs.Add({ Run.Data, Run.DeltaTime, Run.Start + Offset, FMath::Min(VelocityJobSize, Run.Num - Offset) });
+		}
+	}
+
+	const EParallelForFlags Flags = NumLanes < RMCCVars::BatchedMovementParallelThreshold ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+	ParallelFor(VelocityJobs.Num(), [this](int32 JobIndex)
+	{
+		const FRadicalMovementVelocityRun& Job = VelocityJobs[JobIndex];
+		
+		FMovementVelocityBatch Batch;
+		Batch.Velocities = MakeArrayView(VelocityLanes.Velocities).Slice(Job.Start, Job.Num);
+		Batch.Accelerations = MakeArrayView(VelocityLanes.Accelerations).Slice(Job.Start, Job.Num);
+		Batch.Gravities = MakeArrayView(VelocityLanes.Gravities).Slice(Job.Start, Job.Num);
+		Batch.GravityDirs = MakeArrayView(VelocityLanes.GravityDirs).Slice(Job.Start, Job.Num);
+		Batch.TerminalVelocities = MakeArrayView(VelocityLanes.TerminalVelocities).Slice(Job.Start, Job.Num);
+		Batch.MovementStates = MakeArrayView(VelocityLanes.MovementStates).Slice(Job.Start, Job.Num);
+		Job.Data->CalculateVelocities(Batch, Job.DeltaTime);
+
+		// Each lane belongs to a single component, so the results are scattered straight from the worker
+		for (int32 Lane = Job.Start; Lane < Job.Start + Job.Num; Lane++)
+		{
+			Components[VelocityLanes.Components[Lane]]->BatchedVelocity.Result = VelocityLanes.Velocities[Lane];
+		}
+	}, Flags);
+}
+
+void URadicalMovementSubsystem::CompactComponents()
+{
+	for (int32 Index = Components.Num() - 1; Index >= 0; Index--)
+	{
+		if (!Components[Index])
+		{
+			Components.RemoveAtSwap(Index);
+			States.RemoveAtSwap(Index);
+		}
+	}
+	bPendingCompaction = false;
+}
+
+void URadicalMovementSubsystem::RegisterRepulsionComponent(URadicalMovementComponent* Component)
+{
+	if (!Component || Component->RepulsionIndex != INDEX_NONE)
+	{
+		return;
+	}
+
+	Component->RepulsionIndex = RepulsionComponents.Add(Component);
+	RepulsionEntries.AddDefaulted();
+	RepulsionResults.Add(FVector::ZeroVector);
+}
+
+void URadicalMovementSubsystem::UnregisterRepulsionComponent(URadicalMovementComponent* Component)
+{
+	const int32 Index = Component ? Component->RepulsionIndex : INDEX_NONE;
+	if (!RepulsionComponents.IsValidIndex(Index) || RepulsionComponents[Index] != Component)
+	{
+		return;
+	}
+
+	Component->RepulsionIndex = INDEX_NONE;
+
+	// Results are only read back by index, swapping them along keeps them valid for the rest of the frame
+	RepulsionComponents.RemoveAtSwap(Index);
+	RepulsionEntries.RemoveAtSwap(Index);
+	RepulsionResults.RemoveAtSwap(Index);
+	if (RepulsionComponents.IsValidIndex(Index))
+	{
+		RepulsionComponents[Index]->RepulsionIndex = Index;
+	}
+}
+
+FVector URadicalMovementSubsystem::GetPawnRepulsion(const URadicalMovementComponent* Component)
+{
+	const int32 Index = Component ? Component->RepulsionIndex : INDEX_NONE;
+	if (!RepulsionResults.IsValidIndex(Index) || RMCCVars::PawnRepulsion <= 0)
+	{
+		return FVector::ZeroVector;
+	}
+
+	if (RepulsionFrame != GFrameCounter)
+	{
+		UpdatePawnRepulsion();
+	}
+
+	return RepulsionResults[Index];
+}
+
+void URadicalMovementSubsystem::UpdatePawnRepulsion()
+{
+	SCOPE_CYCLE_COUNTER(STAT_PawnRepulsion)
+	SET_DWORD_STAT(STAT_NumRepulsionPawns, RepulsionComponents.Num());
+
+	RepulsionFrame = GFrameCounter;
+	const int32 NumEntries = RepulsionComponents.Num();
+
+	/* Gather: Capsules as they are on the first request of the frame, pawns that already moved this frame are one update ahead of the rest */
+	float MaxRadius = 0.f;
+	float MaxHalfHeight = 0.f;
+	for (int32 Index = 0; Index < NumEntries; Index++)
+	{
+		const URadicalMovementComponent* Component = RepulsionComponents[Index];
+		FPawnRepulsionEntry& Entry = RepulsionEntries[Index];
+		Entry.bValid = IsValid(Component) && Component->IsActive() && Component->UpdatedComponent && Component->CharacterOwner
+						&& Component->PhysicsState != STATE_None;
+		if (!Entry.bValid)
+		{
+			continue;
+		}
+
+		float CapsuleRadius, CapsuleHalfHeight;
+		Component->CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(CapsuleRadius, CapsuleHalfHeight);
+
+		Entry.Location = Component->UpdatedComponent->GetComponentLocation();
+		Entry.Up = Component->GetUpOrientation(MODE_PawnUp);
+		Entry.Radius = CapsuleRadius * Component->PawnRepulsionRadiusScale;
+		Entry.HalfHeight = CapsuleHalfHeight;
+		Entry.Strength = Component->PawnRepulsionStrength;
+		MaxRadius = FMath::Max(MaxRadius, Entry.Radius);
+		MaxHalfHeight = FMath::Max(MaxHalfHeight, Entry.HalfHeight);
+	}
+
+	/* Hash: Cells are as wide as the largest possible pair distance, so neighbours are always within the adjacent cells */
+	RepulsionCellSize = FMath::Max(2.f * FMath::Sqrt(FMath::Square(MaxRadius) + FMath::Square(MaxHalfHeight)), 1.f);
+	RepulsionCells.Reset();
+	for (int32 Index = 0; Index < NumEntries; Index++)
+	{
+		if (RepulsionEntries[Index].bValid)
+		{
+			RepulsionCells.FindOrAdd(GetRepulsionCell(RepulsionEntries[Index].Location, RepulsionCellSize)).Y++;
+		}
+	}
+
+	int32 CellStart = 0;
+	for (TPair<FIntVector, FIntPoint>& Cell : RepulsionCells)
+	{
+		Cell.Value.X = CellStart;
+		CellStart += Cell.Value.Y;
+		Cell.Value.Y = 0;
+	}
+
+	RepulsionCellEntries.SetNumUninitialized(CellStart);
+	for (int32 Index = 0; Index < NumEntries; Index++)
+	{
+		if (RepulsionEntries[Index].bValid)
+		{
+			FIntPoint& Cell = RepulsionCells.FindChecked(GetRepulsionCell(RepulsionEntries[Index].Location, RepulsionCellSize));
+			RepulsionCellEntries[Cell.X + Cell.Y++] = Index;
+		}
+	}
+
+	/* Solve: Only reads the hash, each pawn writes its own result */
+	const EParallelForFlags Flags = NumEntries < RMCCVars::PawnRepulsionParallelThreshold ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+	ParallelFor(NumEntries, [this](int32 Index)
+	{
+		const FPawnRepulsionEntry& Entry = RepulsionEntries[Index];
+		FVector Repulsion = FVector::ZeroVector;
+
+		if (Entry.bValid && Entry.Strength > 0.f)
+		{
+			const FIntVector Cell = GetRepulsionCell(Entry.Location, RepulsionCellSize);
+			for (int32 X = -1; X <= 1; X++)
+			for (int32 Y = -1; Y <= 1; Y++)
+			for (int32 Z = -1; Z <= 1; Z++)
+			{
+				const FIntPoint* CellRange = RepulsionCells.Find(Cell + FIntVector(X, Y, Z));
+				if (!CellRange)
+				{
+					continue;
+				}
+
+				for (int32 CellIndex = CellRange->X; CellIndex < CellRange->X + CellRange->Y; CellIndex++)
+				{
+					const int32 OtherIndex = RepulsionCellEntries[CellIndex];
+					if (OtherIndex == Index)
+					{
+						continue;
+					}
+
+					const FPawnRepulsionEntry& Other = RepulsionEntries[OtherIndex];
+					const FVector Delta = Entry.Location - Other.Location;
+					const float VerticalDist = Delta | Entry.Up;
+					if (FMath::Abs(VerticalDist) > Entry.HalfHeight + Other.HalfHeight)
+					{
+						continue;
+					}
+
+					const FVector PlanarDelta = Delta - Entry.Up * VerticalDist;
+					const float CombinedRadius = Entry.Radius + Other.Radius;
+					const float DistSq = PlanarDelta.SizeSquared();
+					if (DistSq >= FMath::Square(CombinedRadius))
+					{
+						continue;
+					}
+
+					// Stacked pawns are pushed apart along a direction both of them agree on
+					const float Dist = FMath::Sqrt(DistSq);
+					const FVector Direction = Dist > UE_KINDA_SMALL_NUMBER ? PlanarDelta / Dist : FVector::VectorPlaneProject(FVector::ForwardVector, Entry.Up).GetSafeNormal() * (Index < OtherIndex ? 1.f : -1.f);
+					Repulsion += Direction * (1.f - Dist / CombinedRadius);
+				}
+			}
+		}
+
+		RepulsionResults[Index] = Repulsion * Entry.Strength;
+	}, Flags);
+}
+
+FMovementBaseState URadicalMovementSubsystem::GetMovementBaseState(const UPrimitiveComponent* MovementBase, FName BoneName)
+{
+	const FMovementBaseCacheEntry* Entry = FindMovementBaseCacheEntry(MovementBase, BoneName);
+	return Entry ? Entry->State : ComputeMovementBaseState(MovementBase, BoneName);
+}
+
+FMovementBaseDelta URadicalMovementSubsystem::GetMovementBaseDelta(const UPrimitiveComponent* MovementBase, FName BoneName, const FVector& OldLocation, const FQuat& OldRotation)
+{
+	FMovementBaseCacheEntry* Entry = FindMovementBaseCacheEntry(MovementBase, BoneName);
+	if (!Entry)
+	{
+		return ComputeMovementBaseDelta(ComputeMovementBaseState(MovementBase, BoneName), OldLocation, OldRotation);
+	}
+
+	// The delta is only valid for the state it was computed against, the entry's state is replaced whenever the base moves
+	FMovementBaseDelta& Delta = Entry->Delta;
+	if (Delta.bHasTransform && Delta.OldLocation == OldLocation && Delta.OldRotation == OldRotation
+		&& Delta.NewLocation == Entry->State.Location && Delta.NewRotation == Entry->State.Rotation)
+	{
+		INC_DWORD_STAT(STAT_MovementBaseDeltaHits)
+		return Delta;
+	}
+
+	Delta = ComputeMovementBaseDelta(Entry->State, OldLocation, OldRotation);
+	return Delta;
+}
+
+FMovementBaseDelta URadicalMovementSubsystem::ComputeMovementBaseDelta(const FMovementBaseState& State, const FVector& OldLocation, const FQuat& OldRotation)
+{
+	FMovementBaseDelta Delta;
+	Delta.bHasTransform = State.bHasTransform;
+	if (!Delta.bHasTransform)
+	{
+		return Delta;
+	}
+
+	Delta.OldLocation = OldLocation;
+	Delta.OldRotation = OldRotation;
+	Delta.NewLocation = State.Location;
+	Delta.NewRotation = State.Rotation;
+	Delta.bRotationChanged = !OldRotation.Equals(State.Rotation, 1e-8f);
+	Delta.DeltaRotation = Delta.bRotationChanged ? State.Rotation * OldRotation.Inverse() : FQuat::Identity;
+	Delta.bMoved = Delta.bRotationChanged || OldLocation != State.Location;
+	return Delta;
+}
+
+URadicalMovementSubsystem::FMovementBaseCacheEntry* URadicalMovementSubsystem::FindMovementBaseCacheEntry(const UPrimitiveComponent* MovementBase, FName BoneName)
+{
+	// Bones & sockets can be animated without their component moving, which the cached component transform can't catch
+	if (!MovementBase || BoneName != NAME_None || RMCCVars::MovementBaseCache <= 0 || MovementBaseUtility::IsSimulatedBase(MovementBase))
+	{
+		return nullptr;
+	}
+
+	// Only keep a frame's worth of bases around, the keys can't outlive the frame they were added on
+	if (MovementBaseCacheFrame != GFrameCounter)
+	{
+		MovementBaseCache.Reset();
+		MovementBaseCacheFrame = GFrameCounter;
+	}
+
+	const FTransform& ComponentTransform = MovementBase->GetComponentTransform();
+	FMovementBaseCacheEntry& Entry = MovementBaseCache.FindOrAdd(MovementBase);
+	if (Entry.State.bHasTransform && Entry.ComponentTransform.Equals(ComponentTransform, 0.f))
+	{
+		INC_DWORD_STAT(STAT_MovementBaseCacheHits)
+		return &Entry;
+	}
+
+	INC_DWORD_STAT(STAT_MovementBaseCacheMisses)
+	Entry.State = ComputeMovementBaseState(MovementBase, BoneName);
+	Entry.ComponentTransform = ComponentTransform;
+	return &Entry;
+}
+
+FMovementBaseState URadicalMovementSubsystem::ComputeMovementBaseState(const UPrimitiveComponent* MovementBase, FName BoneName)
+{
+	FMovementBaseState State;
+	State.bHasTransform = MovementBaseUtility::GetMovementBaseTransform(MovementBase, BoneName, State.Location, State.Rotation);
+
+	if (MovementBaseUtility::IsDynamicBase(MovementBase))
+	{
+		State.LinearVelocity = MovementBaseUtility::GetMovementBaseVelocity(MovementBase, BoneName);
+		if (const FBodyInstance* BodyInstance = MovementBase->GetBodyInstance(BoneName))
+		{
+			State.AngularVelocity = BodyInstance->GetUnrealWorldAngularVelocityInRadians();
+		}
+	}
+
+	return State;
+}
@@ -0,0 +1,63 @@
+﻿// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/MovementTestWorld.h"
+#include "RadicalMovementComponent.h"
+#include "Subsystems/RadicalMovementSubsystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/// @brief	Moves two characters with the same input, one ticked by the URadicalMovementSubsystem batch and one by its own tick function,
+///			and checks that they follow the same path. The batch integrates velocities in float precision, so they match within a tolerance
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBatchedMovementTest, "CoreFramework.Movement.BatchedMovement", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBatchedMovementTest::RunTest(const FString& Parameters)
+{
+	constexpr float DeltaTime = 1.f / 60.f;
+	constexpr int32 NumFrames = 180;
+	constexpr float LocationTolerance = 1.f;		// cm
+	constexpr float VelocityTolerance = 1.f;		// cm/s
+	
+	FMovementTestWorld TestWorld;
+	URadicalMovementSubsystem* MovementSubsystem = TestWorld.World->GetSubsystem<URadicalMovementSubsystem>();
+	if (!TestNotNull(TEXT("Movement subsystem"), MovementSubsystem)) return false;
+
+	// Both start in the air, so the run goes through falling, landing, ground movement and braking
+	ARadicalCharacter* Unbatched = TestWorld.SpawnCharacter(FVector(0.f, -500.f, 200.f));
+	ARadicalCharacter* Batched = TestWorld.SpawnCharacter(FVector(0.f, 500.f, 200.f));
+	if (!TestNotNull(TEXT("Unbatched character"), Unbatched) || !TestNotNull(TEXT("Batched character"), Batched)) return false;
+	
+	// Components register themselves on begin play when rmc.BatchedMovement is set
+	MovementSubsystem->UnregisterComponent(Unbatched->GetCharacterMovement());
+	if (!Batched->GetCharacterMovement()->IsMovementBatched())
+	{
+		MovementSubsystem->RegisterComponent(Batched->GetCharacterMovement());
+	}
+	if (!TestTrue(TEXT("Character is batched"), Batched->GetCharacterMovement()->IsMovementBatched())) return false;
+	TestFalse(TEXT("Character isn't batched"), Unbatched->GetCharacterMovement()->IsMovementBatched());
+
+	const FVector Offset = Batched->GetActorLocation() - Unbatched->GetActorLocation();
+	double MaxLocationError = 0.0;
+	double MaxVelocityError = 0.0;
+	for (int32 Frame = 0; Frame < NumFrames; Frame++)
+	{
+		// Forward, then turning back diagonally, then no input
+		const FVector Input = Frame < NumFrames / 3 ? FVector::ForwardVector : (Frame < 2 * NumFrames / 3 ? FVector(-1.f, 1.f, 0.f).GetSafeNormal() : FVector::ZeroVector);
+		Unbatched->AddMovementInput(Input);
+		Batched->AddMovementInput(Input);
+
+		TestWorld.Tick(DeltaTime);
+
+		MaxLocationError = FMath::Max(MaxLocationError, FVector::Dist(Batched->GetActorLocation() - Offset, Unbatched->GetActorLocation()));
+		MaxVelocityError = FMath::Max(MaxVelocityError, FVector::Dist(Batched->GetVelocity(), Unbatched->GetVelocity()));
+	}
+
+	AddInfo(FString::Printf(TEXT("Max location error %.4f cm, max velocity error %.4f cm/s over %d frames"), MaxLocationError, MaxVelocityError, NumFrames));
+	TestTrue(TEXT("Unbatched character moved"), !Unbatched->GetActorLocation().Equals(FVector(0.f, -500.f, 200.f), 1.f));
+	TestTrue(TEXT("Batched location matches unbatched"), MaxLocationError <= LocationTolerance);
+	TestTrue(TEXT("Batched velocity matches unbatched"), MaxVelocityError <= VelocityTolerance);
+	
+	return true;
+}
+
+#endif
@@ -0,0 +1,79 @@
+﻿// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/MovementTestWorld.h"
+#include "RadicalMovementComponent.h"
+#include "Subsystems/RadicalMovementSubsystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/// @brief	Packs a crowd of batched characters with pawn repulsion tight enough for every one of them to be pushed by its neighbours, and checks
+///			the velocities the batch integrates ahead are used by their updates instead of being recalculated (STAT_BatchedVelocitiesUsed)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBatchedVelocityCrowdTest, "CoreFramework.Movement.BatchedVelocityCrowd", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBatchedVelocityCrowdTest::RunTest(const FString& Parameters)
+{
+	constexpr float DeltaTime = 1.f / 60.f;
+	constexpr int32 NumFrames = 120;
+	constexpr int32 GridSize = 6;
+	constexpr float Spacing = 40.f;		// cm, under a capsule's diameter so neighbours overlap
+	
+	FMovementTestWorld TestWorld;
+	URadicalMovementSubsystem* MovementSubsystem = TestWorld.World->GetSubsystem<URadicalMovementSubsystem>();
+	if (!TestNotNull(TEXT("Movement subsystem"), MovementSubsystem)) return false;
+
+	TArray<ARadicalCharacter*> Crowd;
+	for (int32 X = 0; X < GridSize; X++)
+	for (int32 Y = 0; Y < GridSize; Y++)
+	{
+		ARadicalCharacter* Character = TestWorld.SpawnCharacter(FVector(X * Spacing, Y * Spacing, 100.f));
+		if (!TestNotNull(TEXT("Crowd character"), Character)) return false;
+
+		// Components register themselves on begin play when rmc.BatchedMovement is set
+		URadicalMovementComponent* Movement = Character->GetCharacterMovement();
+		Movement->bEnablePawnRepulsion = true;
+		MovementSubsystem->RegisterRepulsionComponent(Movement);
+		if (!Movement->IsMovementBatched())
+		{
+			MovementSubsystem->RegisterComponent(Movement);
+		}
+		if (!TestTrue(TEXT("Crowd character is batched"), Movement->IsMovementBatched())) return false;
+		
+		Crowd.Add(Character);
+	}
+
+	const FBox StartBounds(Crowd[0]->GetActorLocation(), Crowd.Last()->GetActorLocation());
+	
+	uint64 StartGathered, StartUsed;
+	MovementSubsystem->GetBatchedVelocityCounts(StartGathered, StartUsed);
+	
+	for (int32 Frame = 0; Frame < NumFrames; Frame++)
+	{
+		// The crowd walks forward for a while, then is only pushed apart by the repulsion
+		if (Frame < NumFrames / 2)
+		{
+			for (ARadicalCharacter* Character : Crowd) Character->AddMovementInput(FVector::ForwardVector);
+		}
+
+		TestWorld.Tick(DeltaTime);
+	}
+
+	uint64 Gathered, Used;
+	MovementSubsystem->GetBatchedVelocityCounts(Gathered, Used);
+	Gathered -= StartGathered;
+	Used -= StartUsed;
+
+	FBox EndBounds(ForceInit);
+	for (const ARadicalCharacter* Character : Crowd) EndBounds += Character->GetActorLocation();
+
+	const double UsedRatio = Gathered > 0 ? static_cast<double>(Used) / Gathered : 0.0;
+	AddInfo(FString::Printf(TEXT("%d characters over %d frames: %llu batched velocities gathered, %llu used (%.1f%%)"), Crowd.Num(), NumFrames, Gathered, Used, UsedRatio * 100.0));
+
+	TestTrue(TEXT("Crowd was pushed apart"), EndBounds.GetSize().Y > StartBounds.GetSize().Y);
+	TestTrue(TEXT("Batched velocities were gathered"), Gathered > 0);
+	TestTrue(TEXT("Batched velocities were used under pawn repulsion"), UsedRatio > 0.0);
+	
+	return true;
+}
+
+#endif
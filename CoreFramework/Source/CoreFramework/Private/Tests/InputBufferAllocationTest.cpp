@@ -0,0 +1,32 @@
+﻿// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Debug/InputBufferBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/// @brief	Drives the benchmark's synthetic input buffer with every feature in use (button & axis actions, motion commands, press/hold/release
+///			& sequence bindings, consuming) and checks UpdateBuffer & EvaluateEvents make no heap allocations once the buffer is warm
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInputBufferAllocationTest, "CoreFramework.InputBuffer.SteadyStateAllocations", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FInputBufferAllocationTest::RunTest(const FString& Parameters)
+{
+	FInputBufferBenchmarkSettings Settings;
+	Settings.NumUpdates = 1000;
+	Settings.NumActions = 8;
+	Settings.NumMotionActions = 4;
+	Settings.BindingsPerAction = 4;
+	Settings.ConsumeInterval = 4;
+
+	FInputBufferBenchmarkResults Results;
+	if (!TestTrue(TEXT("Synthetic buffer ran"), FInputBufferBenchmark::Run(Settings, Results))) return false;
+	if (!TestTrue(TEXT("Buffer reached its steady state"), Results.NumWarmUpdates > 0)) return false;
+
+	TestTrue(TEXT("Scripted input fired events"), Results.NumEvents > 0);
+	TestEqual(TEXT("Allocations in warm UpdateBuffer calls"), Results.WarmUpdateAllocations, 0ll);
+	TestEqual(TEXT("Allocations in warm EvaluateEvents calls"), Results.WarmEvaluateAllocations, 0ll);
+
+	return true;
+}
+
+#endif
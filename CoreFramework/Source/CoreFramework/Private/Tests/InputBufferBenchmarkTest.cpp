@@ -0,0 +1,75 @@
+﻿// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Debug/InputBufferBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace InputBufferBenchmarkTest
+{
+	static FInputBufferBenchmarkSettings DefaultSettings;
+	
+	FAutoConsoleVariableRef CVarNumUpdates(TEXT("ib.Benchmark.NumUpdates"), DefaultSettings.NumUpdates, TEXT("Buffer updates driven by the input buffer benchmark test"), ECVF_Default);
+	FAutoConsoleVariableRef CVarNumActions(TEXT("ib.Benchmark.NumActions"), DefaultSettings.NumActions, TEXT("Button actions of the benchmark's synthetic input map (Max 16)"), ECVF_Default);
+	FAutoConsoleVariableRef CVarNumMotionActions(TEXT("ib.Benchmark.NumMotionActions"), DefaultSettings.NumMotionActions, TEXT("Motion actions of the benchmark's synthetic directional map (Max 4, 0 skips directionals)"), ECVF_Default);
+	FAutoConsoleVariableRef CVarBindingsPerAction(TEXT("ib.Benchmark.BindingsPerAction"), DefaultSettings.BindingsPerAction, TEXT("Action bindings bound to each buffered action by the benchmark"), ECVF_Default);
+	FAutoConsoleVariableRef CVarBufferSize(TEXT("ib.Benchmark.BufferSize"), DefaultSettings.BufferSize, TEXT("Buffer size the benchmark runs with, 0 keeps the project's buffer size"), ECVF_Default);
+	FAutoConsoleVariableRef CVarConsumeInterval(TEXT("ib.Benchmark.ConsumeInterval"), DefaultSettings.ConsumeInterval, TEXT("Updates between ConsumeInput calls in the benchmark, 0 never consumes"), ECVF_Default);
+	FAutoConsoleVariableRef CVarNumSnapshots(TEXT("ib.Benchmark.NumSnapshots"), DefaultSettings.NumSnapshots, TEXT("Snapshots in the benchmark's rollback ring, saved after every update (0 disables snapshots)"), ECVF_Default);
+	FAutoConsoleVariableRef CVarRollbackInterval(TEXT("ib.Benchmark.RollbackInterval"), DefaultSettings.RollbackInterval, TEXT("Updates between snapshot restores in the benchmark, 0 never restores"), ECVF_Default);
+
+	/* Budget of a single snapshot save or restore, rollback saves every frame & restores several times per frame */
+	static double SnapshotTargetMicros = 5.0;
+	FAutoConsoleVariableRef CVarSnapshotTargetMicros(TEXT("ib.Benchmark.SnapshotTargetMicros"), SnapshotTargetMicros, TEXT("Median time (us) the benchmark test allows a snapshot save or restore to take"), ECVF_Default);
+}
+
+/// @brief	Benchmarks a synthetic input buffer. Counts come from the ib.Benchmark.* cvars and can be overridden per run through the
+///			test parameters (e.g "NumUpdates=50000 NumActions=16 BufferSize=60")
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInputBufferBenchmarkTest, "CoreFramework.InputBuffer.Benchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FInputBufferBenchmarkTest::RunTest(const FString& Parameters)
+{
+	FInputBufferBenchmarkSettings Settings = InputBufferBenchmarkTest::DefaultSettings;
+	FParse::Value(*Parameters, TEXT("NumUpdates="), Settings.NumUpdates);
+	FParse::Value(*Parameters, TEXT("NumActions="), Settings.NumActions);
+	FParse::Value(*Parameters, TEXT("NumMotionActions="), Settings.NumMotionActions);
+	FParse::Value(*Parameters, TEXT("BindingsPerAction="), Settings.BindingsPerAction);
+	FParse::Value(*Parameters, TEXT("BufferSize="), Settings.BufferSize);
+	FParse::Value(*Parameters, TEXT("ConsumeInterval="), Settings.ConsumeInterval);
+	FParse::Value(*Parameters, TEXT("NumSnapshots="), Settings.NumSnapshots);
+	FParse::Value(*Parameters, TEXT("RollbackInterval="), Settings.RollbackInterval);
+	Settings.NumUpdates = FMath::Max(1, Settings.NumUpdates);
+
+	FInputBufferBenchmarkResults Results;
+	if (!TestTrue(TEXT("Benchmark ran"), FInputBufferBenchmark::Run(Settings, Results))) return false;
+
+	AddInfo(FString::Printf(TEXT("Input buffer benchmark: %d updates | %d actions | %d motion actions | buffer size %d | %d bindings | %d events fired"),
+		Results.NumUpdates, Results.NumActions, Results.NumMotionActions, Results.BufferSize, Results.NumBindings, Results.NumEvents));
+	for (const FString& Line : Results.Report)
+	{
+		AddInfo(Line);
+	}
+	
+	TestEqual(TEXT("Buffer updates driven"), Results.NumUpdates, Settings.NumUpdates);
+	if (Settings.BindingsPerAction > 0 || Settings.NumMotionActions > 0)
+	{
+		TestTrue(TEXT("Scripted input fired events"), Results.NumEvents > 0);
+	}
+
+	// Medians are compared against the budget, a single preempted call shouldn't fail the run
+	if (Settings.NumSnapshots > 0)
+	{
+		AddInfo(FString::Printf(TEXT("Snapshots: %d bytes | save p50 %.3f us | restore p50 %.3f us | target %.1f us"),
+			Results.SnapshotSize, Results.SaveSnapshotMedianMicros, Results.RestoreSnapshotMedianMicros, InputBufferBenchmarkTest::SnapshotTargetMicros));
+		
+		TestTrue(TEXT("Snapshot save within target"), Results.SaveSnapshotMedianMicros <= InputBufferBenchmarkTest::SnapshotTargetMicros);
+		if (Settings.RollbackInterval > 0)
+		{
+			TestTrue(TEXT("Snapshot restore within target"), Results.RestoreSnapshotMedianMicros <= InputBufferBenchmarkTest::SnapshotTargetMicros);
+		}
+	}
+	
+	return true;
+}
+
+#endif
@@ -0,0 +1,119 @@
+﻿// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/MovementTestWorld.h"
+#include "RadicalMovementComponent.h"
+#include "MovementData.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/// @brief	Compares UMovementData::CalculateVelocities against CalculateVelocity lane by lane, over every movement state with braking,
+///			input and speeds below & above max speed. The batch integrates in float precision, so lanes match within a tolerance
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMovementBatchVelocityTest, "CoreFramework.Movement.BatchVelocity", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FMovementBatchVelocityTest::RunTest(const FString& Parameters)
+{
+	static constexpr EMovementState States[] = { STATE_Grounded, STATE_Falling, STATE_General };
+	constexpr float DeltaTime = 1.f / 60.f;
+	constexpr float Tolerance = 0.05f;		// cm/s
+	
+	FMovementTestWorld TestWorld;
+	ARadicalCharacter* Character = TestWorld.SpawnCharacter(FVector(0.f, 0.f, 200.f));
+	if (!TestNotNull(TEXT("Character"), Character)) return false;
+	
+	URadicalMovementComponent* Component = Character->GetCharacterMovement();
+	UMovementData* Data = Component ? Component->GetMovementData() : nullptr;
+	if (!TestNotNull(TEXT("Movement data"), Data) || !TestTrue(TEXT("Movement data can calculate velocities in batch"), Data->CanCalculateVelocitiesInBatch())) return false;
+	if (!TestNotNull(TEXT("Physics volume"), Component->GetPhysicsVolume())) return false;
+
+	/* Default braking, then braking with separate max velocity deceleration so both branches of BrakingDecelerationToUse are covered */
+	auto ConfigureBraking = [Data](bool bSeparateBraking)
+	{
+		Data->BrakingDecelerationGrounded = bSeparateBraking ? 2048.f : 0.f;
+		Data->BrakingDecelerationAerial = bSeparateBraking ? 512.f : 0.f;
+		Data->BrakingFrictionGrounded = bSeparateBraking ? 2.f : 0.f;
+		Data->bSeparateMaxVelAndInputBrakingDeceleration = bSeparateBraking;
+		Data->MaxVelBrakingDecelerationGrounded = 1024.f;
+		Data->MaxVelBrakingDecelerationAerial = 256.f;
+	};
+	
+	const float MaxSpeedScaled = Data->MaxSpeed * Data->MaxSpeedMultiplier;
+	const FVector Inputs[] = { FVector::ZeroVector, FVector::ForwardVector, FVector(1.f, 1.f, 0.f).GetSafeNormal() * 0.5f, FVector::BackwardVector };
+	const FVector TestVelocities[] =
+	{
+		FVector::ZeroVector,
+		FVector::ForwardVector * MaxSpeedScaled * 0.5f,
+		FVector::ForwardVector * MaxSpeedScaled * 1.5f,
+		FVector::RightVector * MaxSpeedScaled * 0.75f,
+		FVector(-0.5f, 0.3f, 0.8f) * MaxSpeedScaled,
+		FVector::DownVector * 4000.f + FVector::ForwardVector * 5.f
+	};
+
+	double MaxError = 0.0;
+	int32 NumLanes = 0;
+	for (const bool bSeparateBraking : { false, true })
+	{
+		ConfigureBraking(bSeparateBraking);
+		
+		for (const FVector& Input : Inputs)
+		{
+			Character->AddMovementInput(Input, 1.f, true);
+			Character->ConsumeMovementInputVector();
+			const FVector Acceleration = Data->ComputeInputAcceleration(Component);
+
+			TArray<FVector> Velocities, Expected, Accelerations, Gravities, GravityDirs;
+			TArray<float> TerminalVelocities;
+			TArray<EMovementState> MovementStates;
+			for (const EMovementState State : States)
+			{
+				for (const FVector& TestVelocity : TestVelocities)
+				{
+					Velocities.Add(TestVelocity);
+					Accelerations.Add(Acceleration);
+					Gravities.Add(Component->GetGravity());
+					GravityDirs.Add(Component->GetGravityDir());
+					TerminalVelocities.Add(Component->GetPhysicsVolume()->TerminalVelocity);
+					MovementStates.Add(State);
+				}
+			}
+
+			/* Scalar */
+			for (int32 Index = 0; Index < Velocities.Num(); Index++)
+			{
+				TGuardValue<FVector> RestoreVelocity(Component->Velocity, Velocities[Index]);
+				TGuardValue<TEnumAsByte<EMovementState>> RestoreState(Component->PhysicsState, MovementStates[Index]);
+				TGuardValue<float> RestoreTopSpeed(Data->InstanceTopSpeed, Data->InstanceTopSpeed);
+				
+				Data->CalculateVelocity(Component, DeltaTime);
+				Expected.Add(Component->Velocity);
+			}
+
+			/* Batch, lane counts that aren't a multiple of the register width also cover the padding lanes */
+			FMovementVelocityBatch Batch;
+			Batch.Velocities = Velocities;
+			Batch.Accelerations = Accelerations;
+			Batch.Gravities = Gravities;
+			Batch.GravityDirs = GravityDirs;
+			Batch.TerminalVelocities = TerminalVelocities;
+			Batch.MovementStates = MovementStates;
+			Data->CalculateVelocities(Batch, DeltaTime);
+
+			for (int32 Index = 0; Index < Velocities.Num(); Index++)
+			{
+				const double Error = FVector::Dist(Velocities[Index], Expected[Index]);
+				MaxError = FMath::Max(MaxError, Error);
+				if (Error > Tolerance)
+				{
+					AddError(FString::Printf(TEXT("Separate braking %d, State %d, Input %s, Velocity %s. Batch %s, Scalar %s (Error %.4f)"), bSeparateBraking, static_cast<int32>(MovementStates[Index]),
+						*Input.ToCompactString(), *TestVelocities[Index % UE_ARRAY_COUNT(TestVelocities)].ToCompactString(), *Velocities[Index].ToCompactString(), *Expected[Index].ToCompactString(), Error));
+				}
+			}
+			NumLanes += Velocities.Num();
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("Compared %d lanes, max error %.4f cm/s"), NumLanes, MaxError));
+	return true;
+}
+
+#endif
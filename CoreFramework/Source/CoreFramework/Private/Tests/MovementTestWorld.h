@@ -0,0 +1,61 @@
+﻿// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Components/StaticMeshComponent.h"
+#include "RadicalCharacter.h"
+
+/// @brief	Game world the movement tests run in, playing once constructed and destroyed with the scope. Holds a flat floor whose top is at Z = 0
+struct FMovementTestWorld
+{
+	FMovementTestWorld()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("MovementTestWorld"));
+		
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		const FURL URL;
+		World->SetGameMode(URL);
+		World->InitializeActorsForPlay(URL);
+		World->BeginPlay();
+
+		if (UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")))
+		{
+			// The cube is 100 units wide, centered on its origin
+			const FTransform FloorTransform(FQuat::Identity, FVector(0.f, 0.f, -50.f), FVector(200.f, 200.f, 1.f));
+			AStaticMeshActor* Floor = World->SpawnActor<AStaticMeshActor>(AStaticMeshActor::StaticClass(), FloorTransform);
+			Floor->GetStaticMeshComponent()->SetStaticMesh(Cube);
+		}
+	}
+
+	~FMovementTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	ARadicalCharacter* SpawnCharacter(const FVector& Location) const
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		return World->SpawnActor<ARadicalCharacter>(Location, FRotator::ZeroRotator, SpawnParams);
+	}
+
+	void Tick(float DeltaTime) const
+	{
+		World->Tick(LEVELTICK_All, DeltaTime);
+	}
+
+	UWorld* World = nullptr;
+};
+
+#endif
@@ -0,0 +1,107 @@
+﻿// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/MovementTestWorld.h"
+#include "Debug/ThreadAllocationCounter.h"
+#include "RadicalMovementComponent.h"
+#include "RootMotionSourceCFW.h"
+#include "RootMotionTasks/RootMotionTask_ConstantForce.h"
+#include "Curves/CurveFloat.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/// @brief	Applies and removes a dash-like constant force on a character over and over, checking the task object is recycled, handles to
+///			a finished use stop resolving, and applying & removing the task makes no heap allocations once the task & source pools are warm.
+///			Then recycles a curve shaped jump force, checking it rebakes its path into the storage it kept from its previous use
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRootMotionTaskPoolTest, "CoreFramework.RootMotion.TaskPool", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FRootMotionTaskPoolTest::RunTest(const FString& Parameters)
+{
+	constexpr float DeltaTime = 1.f / 60.f;
+	constexpr int32 NumWarmupUses = 4;
+	constexpr int32 NumUses = 64;
+
+	FMovementTestWorld TestWorld;
+	ARadicalCharacter* Character = TestWorld.SpawnCharacter(FVector(0.f, 0.f, 100.f));
+	if (!TestNotNull(TEXT("Character"), Character)) return false;
+
+	// Settle on the floor before dashing
+	for (int32 Frame = 0; Frame < 10; Frame++) TestWorld.Tick(DeltaTime);
+
+	TSet<const URootMotionTask_Base*> Tasks;
+	FRootMotionTaskHandle PreviousHandle;
+	int64 WarmApplyAllocations = 0;
+	int64 WarmRemoveAllocations = 0;
+	int32 NumStaleHandlesResolved = 0;
+	int32 NumActiveHandlesUnresolved = 0;
+
+	for (int32 Use = 0; Use < NumUses; Use++)
+	{
+		const bool bWarm = Use >= NumWarmupUses;
+
+		if (bWarm) FThreadAllocationCounter::Start();
+		URootMotionTask_ConstantForce* Task = URootMotionTask_ConstantForce::ApplyRootMotionConstantForce(Character, NAME_None, FVector::ForwardVector,
+			1000.f, 0.25f, false, nullptr, ERootMotionFinishVelocityMode::MaintainLastRootMotionVelocity, FVector::ZeroVector, 0.f, true);
+		if (bWarm) WarmApplyAllocations += FThreadAllocationCounter::Stop();
+
+		if (!TestNotNull(TEXT("Task"), Task)) return false;
+		Tasks.Add(Task);
+
+		const FRootMotionTaskHandle Handle = Task->GetHandle();
+		if (PreviousHandle.IsValid()) NumStaleHandlesResolved++;
+		if (!Handle.IsValid()) NumActiveHandlesUnresolved++;
+
+		TestWorld.Tick(DeltaTime);
+
+		// Cancel the dash midway, the group drops the removed source on the next update which frees it for the pool
+		if (bWarm) FThreadAllocationCounter::Start();
+		Task->OnDestroy();
+		if (bWarm) WarmRemoveAllocations += FThreadAllocationCounter::Stop();
+
+		if (Handle.IsValid()) NumStaleHandlesResolved++;
+		PreviousHandle = Handle;
+
+		TestWorld.Tick(DeltaTime);
+	}
+
+	TestEqual(TEXT("Task objects created"), Tasks.Num(), 1);
+	TestEqual(TEXT("Handles resolving after their task finished"), NumStaleHandlesResolved, 0);
+	TestEqual(TEXT("Handles not resolving while their task runs"), NumActiveHandlesUnresolved, 0);
+	TestEqual(TEXT("Allocations applying warm tasks"), WarmApplyAllocations, 0ll);
+	TestEqual(TEXT("Allocations removing warm tasks"), WarmRemoveAllocations, 0ll);
+
+	UCurveFloat* TimeMapping = NewObject<UCurveFloat>(GetTransientPackage());
+	TimeMapping->FloatCurve.AddKey(0.f, 0.f);
+	TimeMapping->FloatCurve.AddKey(0.4f, 0.6f);
+	TimeMapping->FloatCurve.AddKey(1.f, 1.f);
+
+	URadicalMovementComponent* Movement = Character->GetCharacterMovement();
+	const FVector3f* PathData = nullptr;
+	int64 WarmBakeAllocations = 0;
+	int32 NumPathReallocations = 0;
+
+	for (int32 Use = 0; Use < NumUses; Use++)
+	{
+		const bool bWarm = Use >= NumWarmupUses;
+
+		// The source is dropped at the end of each use, handing it back to the pool
+		if (bWarm) FThreadAllocationCounter::Start();
+		const TSharedPtr<FRootMotionSourceCFW_JumpForce> JumpForce = Movement->NewRootMotionSource<FRootMotionSourceCFW_JumpForce>();
+		JumpForce->Distance = 400.f;
+		JumpForce->Height = 150.f;
+		JumpForce->Duration = 0.6f;
+		JumpForce->TimeMappingCurve = TimeMapping;
+		JumpForce->BakePath();
+		if (bWarm) WarmBakeAllocations += FThreadAllocationCounter::Stop();
+
+		if (bWarm && JumpForce->Path.Positions.GetData() != PathData) NumPathReallocations++;
+		PathData = JumpForce->Path.Positions.GetData();
+	}
+
+	TestEqual(TEXT("Jump paths reallocated by recycled sources"), NumPathReallocations, 0);
+	TestEqual(TEXT("Allocations baking recycled jump paths"), WarmBakeAllocations, 0ll);
+
+	return true;
+}
+
+#endif
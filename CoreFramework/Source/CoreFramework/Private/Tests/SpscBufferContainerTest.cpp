@@ -0,0 +1,130 @@
+﻿// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "DataStructures/BufferContainer.h"
+#include "Async/Async.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace SpscBufferContainerTest
+{
+	/// @brief	Element of the stress run, the checksum catches elements read before they were fully written
+	struct FStressItem
+	{
+		uint64 Sequence = 0;
+		uint64 Checksum = 0;
+	};
+
+	static constexpr uint64 ChecksumSalt = 0x9E3779B97F4A7C15ull;
+
+	/// @brief	Outcome of pushing a sequence through a queue
+	struct FStressResults
+	{
+		uint64 NumReceived = 0;
+		uint64 NumOutOfOrder = 0;
+		uint64 NumCorrupted = 0;
+		uint64 NumPeekMismatches = 0;
+		bool bTimedOut = false;
+		bool bEmptyAfterwards = false;
+		double Seconds = 0.0;
+	};
+
+	/// @brief	Pushes NumItems elements from a producer thread while this thread consumes them. Consumption alternates between Pop(Item)
+	///			and Peek then Pop(), so both consumer paths see the producer's writes
+	static FStressResults RunStress(const uint64 NumItems, const uint32 Capacity, const double TimeoutSeconds)
+	{
+		FStressResults Results;
+		TSpscBufferContainer<FStressItem> Queue(Capacity);
+		std::atomic<bool> bAbort = false;
+		const double StartTime = FPlatformTime::Seconds();
+
+		TFuture<void> Producer = Async(EAsyncExecution::Thread, [&Queue, &bAbort, NumItems]()
+		{
+			for (uint64 Sequence = 0; Sequence < NumItems; Sequence++)
+			{
+				const FStressItem Item = { Sequence, Sequence ^ ChecksumSalt };
+				while (!Queue.Push(Item))
+				{
+					if (bAbort.load(std::memory_order_relaxed)) return;
+					FPlatformProcess::Yield();
+				}
+			}
+		});
+
+		FStressItem Item;
+		while (Results.NumReceived < NumItems)
+		{
+			bool bReceived;
+			if (Results.NumReceived % 2 == 0)
+			{
+				bReceived = Queue.Pop(Item);
+			}
+			else
+			{
+				const FStressItem* Front = Queue.Peek();
+				bReceived = Front != nullptr;
+				if (bReceived)
+				{
+					Item = *Front;
+					if (!Queue.Pop()) Results.NumPeekMismatches++;
+				}
+			}
+
+			if (!bReceived)
+			{
+				if (FPlatformTime::Seconds() - StartTime > TimeoutSeconds)
+				{
+					Results.bTimedOut = true;
+					bAbort = true;
+					break;
+				}
+				FPlatformProcess::Yield();
+				continue;
+			}
+
+			if (Item.Sequence != Results.NumReceived) Results.NumOutOfOrder++;
+			if (Item.Checksum != (Item.Sequence ^ ChecksumSalt)) Results.NumCorrupted++;
+			Results.NumReceived++;
+		}
+		Producer.Wait();
+
+		Results.Seconds = FPlatformTime::Seconds() - StartTime;
+		Results.bEmptyAfterwards = Queue.IsEmpty();
+		return Results;
+	}
+}
+
+/// @brief	Pushes a sequence through a TSpscBufferContainer from a producer thread while the test thread consumes it, checking every element
+///			arrives once, in order and fully written. Runs with a single slot queue (producer & consumer contend on every element) and a
+///			wider one. Item count & capacity can be overridden through the test parameters (e.g "NumItems=10000000 Capacity=256")
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpscBufferContainerTest, "CoreFramework.DataStructures.SpscBufferContainer", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSpscBufferContainerTest::RunTest(const FString& Parameters)
+{
+	using namespace SpscBufferContainerTest;
+
+	uint64 NumItems = 1000000;
+	uint32 Capacity = 64;
+	FParse::Value(*Parameters, TEXT("NumItems="), NumItems);
+	FParse::Value(*Parameters, TEXT("Capacity="), Capacity);
+	NumItems = FMath::Max<uint64>(1, NumItems);
+
+	for (const uint32 RunCapacity : { 1u, FMath::Max(1u, Capacity) })
+	{
+		const FStressResults Results = RunStress(NumItems, RunCapacity, 60.0);
+		AddInfo(FString::Printf(TEXT("SPSC stress: %llu items through capacity %u in %.3f s (%.1f M items/s)"),
+			Results.NumReceived, RunCapacity, Results.Seconds, Results.NumReceived / FMath::Max(Results.Seconds, UE_DOUBLE_SMALL_NUMBER) / 1000000.0));
+
+		const FString Run = FString::Printf(TEXT("Capacity %u: "), RunCapacity);
+		TestFalse(Run + TEXT("Timed out"), Results.bTimedOut);
+		TestEqual(Run + TEXT("Items received"), Results.NumReceived, NumItems);
+		TestEqual(Run + TEXT("Items out of order"), Results.NumOutOfOrder, 0ull);
+		TestEqual(Run + TEXT("Items read before fully written"), Results.NumCorrupted, 0ull);
+		TestEqual(Run + TEXT("Peeked items missing on pop"), Results.NumPeekMismatches, 0ull);
+		TestTrue(Run + TEXT("Queue drained"), Results.bEmptyAfterwards);
+	}
+
+	return true;
+}
+
+#endif
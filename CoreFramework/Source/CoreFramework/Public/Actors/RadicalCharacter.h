@@ -325,19 +325,43 @@ public:
 #pragma region Root Motion Tasks Interface
 public:
 	
-	/* Helper function for initializing new root motion tasks */
+	/* Helper function for initializing new root motion tasks, recycling a pooled task of the same class if the character has one */
 	template<class T>
 	static T* NewRootMotionTask(ARadicalCharacter* OwningActor, FName InstanceName = FName())
 	{
 		check(OwningActor);
 
-		T* MyObj = NewObject<T>();
+		T* MyObj = OwningActor->AcquireRootMotionTask<T>();
 		MyObj->InitTask(OwningActor);
 
 		MyObj->ForceName = InstanceName;
 		return MyObj;
 	}
 
+	/// @brief  Resets a finished task and pools it for NewRootMotionTask to recycle. Called by URootMotionTask_Base::OnDestroy
+	void ReleaseRootMotionTask(URootMotionTask_Base* Task);
+
+protected:
+	template<class T>
+	T* AcquireRootMotionTask()
+	{
+		if (URootMotionTask_Base* PooledTask = RecycleRootMotionTask(T::StaticClass()))
+		{
+			return static_cast<T*>(PooledTask);
+		}
+
+		T* NewTask = NewObject<T>(this);
+		RootMotionTasks.Add(NewTask);
+		return NewTask;
+	}
+
+	/// @brief  Takes a pooled task of exactly TaskClass out of the pool, nullptr if there's none
+	URootMotionTask_Base* RecycleRootMotionTask(const UClass* TaskClass);
+
+	/* Every task created for this character, active or pooled. Pooled tasks are recycled instead of creating new objects for each dash or jump */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<URootMotionTask_Base>> RootMotionTasks;
+
 #pragma endregion Root Motion Tasks Interface
 	
 };
@@ -5,7 +5,9 @@
 #include "CoreMinimal.h"
 #include "MovementData.h"
 #include "RootMotionSourceCFW.h"
+#include "Debug/MovementQueryStats.h"
 #include "GameFramework/PawnMovementComponent.h"
+#include "WorldCollision.h"
 #include "RadicalMovementComponent.generated.h"
 
 /* Profiling */
@@ -26,6 +28,8 @@ DECLARE_DELEGATE_ThreeParams(FPostProcessRootMotionRotationSignature, URadicalMo
 /* Forward Declarations */
 class ARadicalCharacter;
 class UMovementData;
+struct FMovementBaseState;
+struct FMovementBaseDelta;
 
 //struct FBasedMovementInfo;
 
@@ -215,6 +219,100 @@ struct COREFRAMEWORK_API FStepDownFloorResult
 	FStepDownFloorResult() : bComputedFloor(false) {}
 };
 
+/* Floor sweep issued through the async trace API from where the pawn is predicted to be on its next update, @see URadicalMovementComponent::bUseAsyncFloorProbes */
+struct COREFRAMEWORK_API FAsyncFloorProbe
+{
+	FTraceHandle Handle;
+	FHitResult Hit;
+	FVector PredictedLocation;
+	FVector UpDirection;
+	float SweepRadius;
+	float TraceDist;
+	double ExpiryTime;
+	uint32 bHasResult : 1;
+
+	FAsyncFloorProbe() : PredictedLocation(FVector::ZeroVector), UpDirection(FVector::UpVector), SweepRadius(0.f), TraceDist(0.f), ExpiryTime(0.0), bHasResult(false) {}
+
+	void Reset()
+	{
+		Handle.Invalidate();
+		bHasResult = false;
+	}
+};
+
+/* Last floor found by FindFloor along with everything it depends on, @see URadicalMovementComponent::bUseFloorCache */
+struct COREFRAMEWORK_API FFloorCacheEntry
+{
+	FGroundingStatus Floor;
+	FVector CapsuleLocation;
+	FVector UpDirection;
+	FVector GravityDirection;
+	FTransform FloorTransform;
+	TWeakObjectPtr<UPrimitiveComponent> FloorComponent;
+	double CacheTime;
+	uint32 OverlapsHash;
+	float CapsuleRadius;
+	float CapsuleHalfHeight;
+	float ProbeDistance;
+	uint32 bValid : 1;
+
+	FFloorCacheEntry() : CapsuleLocation(FVector::ZeroVector), UpDirection(FVector::UpVector), GravityDirection(FVector::DownVector), CacheTime(0.0), OverlapsHash(0), CapsuleRadius(0.f), CapsuleHalfHeight(0.f), ProbeDistance(0.f), bValid(false) {}
+
+	void Invalidate() { bValid = false; FloorComponent.Reset(); }
+};
+
+/* Movement settings applied to pawns within a given significance, @see URadicalMovementComponent::MovementLODTiers */
+USTRUCT(BlueprintType)
+struct COREFRAMEWORK_API FMovementLODTier
+{
+	GENERATED_USTRUCT_BODY()
+
+	/// @brief  Max significance (distance to the closest local viewer, scaled when off screen) this tier is used for
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement LOD", meta=(ClampMin="0", UIMin="0", ForceUnits=cm))
+	float MaxDistance = 0.f;
+
+	/// @brief  Min time between movement updates, the elapsed time is simulated at once. 0 updates every frame
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement LOD", meta=(ClampMin="0", UIMin="0", ForceUnits=s))
+	float UpdateInterval = 0.f;
+
+	/// @brief  Overrides MaxSimulationTimeStep of the component if > 0
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement LOD", meta=(ClampMin="0", UIMin="0", ForceUnits=s))
+	float MaxSimulationTimeStep = 0.f;
+
+	/// @brief  Overrides MaxSimulationIterations of the component if > 0
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement LOD", meta=(ClampMin="0", UIMin="0"))
+	int32 MaxSimulationIterations = 0;
+
+	/// @brief  Whether to perform perch checks and denivelation handling
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement LOD")
+	bool bPerchAndLedgeChecks = true;
+
+	/// @brief  Whether to apply physics interactions (downward and repulsion forces)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement LOD")
+	bool bPhysicsInteraction = true;
+
+	/// @brief  Whether movement debug visualization is drawn
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement LOD")
+	bool bDebugVisualization = true;
+
+	/// @brief  Smooths the mesh between movement updates when UpdateInterval > 0
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement LOD")
+	bool bSmoothSkippedUpdates = true;
+};
+
+/* Sample of a collision free trajectory prediction, @see URadicalMovementComponent::PredictTrajectory */
+USTRUCT(BlueprintType)
+struct COREFRAMEWORK_API FPredictedTrajectorySample
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="Trajectory Prediction")
+	FVector Location = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category="Trajectory Prediction")
+	FVector Velocity = FVector::ZeroVector;
+};
+
 #pragma endregion Structs
 
 #pragma region Debug & Logging
@@ -245,6 +343,9 @@ UCLASS(ClassGroup = "Kinematic Movement", BlueprintType, Blueprintable)
 class COREFRAMEWORK_API URadicalMovementComponent : public UPawnMovementComponent
 {
 	friend class UMovementData;
+	friend class URadicalMovementSubsystem;
+	friend class FMovementBatchVelocityTest;
+	friend class FBatchedVelocityCrowdTest;
 	
 	GENERATED_BODY()
 
@@ -258,6 +359,7 @@ public:
 public:
 	// BEGIN UActorComponent Interface
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void PostLoad() override;
 	virtual void Deactivate() override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -267,6 +369,17 @@ public:
 	FRadicalMovementComponentPostPhysicsTickFunction PostPhysicsTickFunction;
 	
 	virtual void PostPhysicsTickComponent(float DeltaTime, FRadicalMovementComponentPostPhysicsTickFunction& ThisTickFunction);
+
+	/// @brief  Whether this component is ticked by the world's URadicalMovementSubsystem instead of its own tick function
+	FORCEINLINE bool IsMovementBatched() const { return bMovementBatched; }
+
+protected:
+	/// @brief  Consumes input and runs the checks ahead of PerformMovement, shared by TickComponent and the batched tick
+	/// @return True if we should continue with the movement update
+	bool PreTickMovement(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction);
+
+	/// @brief  Physics interactions and debug following PerformMovement, shared by TickComponent and the batched tick
+	void PostTickMovement(float DeltaTime, const FVector& OldRootLocation);
 	
 
 	
@@ -283,6 +396,7 @@ public:
 	virtual void AddRadialForce(const FVector& Origin, float Radius, float Strength, ERadialImpulseFalloff Falloff) override;
 	virtual void AddRadialImpulse(const FVector& Origin, float Radius, float Strength, ERadialImpulseFalloff Falloff, bool bVelChange) override;
 	virtual void StopActiveMovement() override;			// Check CMC
+	virtual bool MoveUpdatedComponentImpl(const FVector& Delta, const FQuat& NewRotation, bool bSweep, FHitResult* OutHit = nullptr, ETeleportType Teleport = ETeleportType::None) override;
 	// END UMovementComponent Interface
 
 	// BEGIN UPawnMovementComponent Interface
@@ -539,6 +653,7 @@ protected:
 	static constexpr float MIN_FLOOR_DIST				= 1.9f; 
 	static constexpr float MAX_FLOOR_DIST				= 2.4f; 
 	static constexpr float SWEEP_EDGE_REJECT_DISTANCE	= 0.15f;
+	static constexpr float FLOOR_SWEEP_SHRINK_SCALE		= 0.9f;
 
 protected:
 	/// @brief  Used within movement code to determine if a change in position is based on normal movement or a teleport. If not a teleport,
@@ -585,11 +700,87 @@ protected:
 	UPROPERTY(Category= "(Radical Movement): Simulation Settings", EditDefaultsOnly, meta=(ClampMin="0", UIMin="0", ForceUnits=cm))
 	float MaxDepenetrationWithPawn;
 
+	/// @brief  If true, the component registers with the URadicalMovementSubsystem on BeginPlay when rmc.BatchedMovement is enabled,
+	///			and gets ticked alongside every other batched component instead of through its own tick function
+	UPROPERTY(Category="(Radical Movement): Simulation Settings", EditDefaultsOnly, AdvancedDisplay)
+	uint8 bAllowBatchedMovement							: 1;
+
+	/// @brief  Set while the URadicalMovementSubsystem owns the tick of this component
+	UPROPERTY(Transient)
+	uint8 bMovementBatched								: 1;
+
+	/// @brief  If true, movement is simulated in steps of FixedTimestep regardless of the frame rate, carrying the leftover frame time over to
+	///			the next update. Makes results independent of the frame rate (e.g for replays or lockstep).
+	UPROPERTY(Category="(Radical Movement): Simulation Settings", EditDefaultsOnly)
+	uint8 bUseFixedTimestep								: 1;
+
+	/// @brief  Interpolates the mesh between the last two simulated states, hiding the difference between the simulation and frame rate.
+	///			The mesh trails the capsule by up to one FixedTimestep.
+	UPROPERTY(Category="(Radical Movement): Simulation Settings", EditDefaultsOnly, meta=(EditCondition="bUseFixedTimestep", EditConditionHides))
+	uint8 bInterpolateFixedTimestep						: 1;
+
+	/// @brief  Delta time of each simulated step when using a fixed timestep
+	UPROPERTY(Category="(Radical Movement): Simulation Settings", EditDefaultsOnly, meta=(EditCondition="bUseFixedTimestep", EditConditionHides, ClampMin="0.004", UIMin="0.004", ClampMax="0.2", UIMax="0.2", ForceUnits=s))
+	float FixedTimestep;
+
+	/// @brief  Max steps simulated in a single update to catch up with the frame time, any time left past that is dropped.
+	///			Prevents long frames from making the next frames even longer.
+	UPROPERTY(Category="(Radical Movement): Simulation Settings", EditDefaultsOnly, meta=(EditCondition="bUseFixedTimestep", EditConditionHides, ClampMin="1", UIMin="1"))
+	int32 MaxFixedStepsPerFrame;
+
+	/* Frame time not simulated yet */
+	float FixedTimestepAccumulator;
+
+	/* State before the last fixed step, interpolated from. Moved along with the movement base, @see UpdateBasedMovement */
+	FVector PreviousSimulatedLocation;
+	FQuat PreviousSimulatedRotation;
+
+	/* Whether a fixed step ran since the previous state was seeded, the mesh isn't interpolated until then */
+	uint8 bHasSimulatedFixedStep						: 1;
+
+	/* Velocity of the first CalculateVelocity of the update, integrated ahead by the URadicalMovementSubsystem batch along with the inputs it was integrated from.
+	   The velocity already holds the pending forces & impulses ApplyAccumulatedForces adds ahead of it */
+	struct FBatchedVelocity
+	{
+		FVector Velocity = FVector::ZeroVector;
+		FVector Acceleration = FVector::ZeroVector;
+		FVector Gravity = FVector::ZeroVector;
+		FVector GravityDir = FVector::DownVector;
+		FVector Result = FVector::ZeroVector;
+		float TerminalVelocity = 0.f;
+		float DeltaTime = 0.f;
+		EMovementState MovementState = STATE_None;
+		bool bValid = false;
+		bool bUsed = false;		// Consumed by the update, @see ConsumeBatchedVelocity
+	};
+	FBatchedVelocity BatchedVelocity;
+
 protected:
 	
 	/// @brief  
 	void PerformMovement(float DeltaTime);
 
+	/// @brief  Runs PerformMovement for the frame, once with the frame time or as many fixed steps as needed if @see bUseFixedTimestep
+	/// @return	The time simulated
+	float SimulateMovement(float DeltaTime);
+
+	/// @brief  Offsets the mesh to where it would be between the last two fixed steps
+	void UpdateFixedTimestepInterpolation();
+
+	/// @brief  Seeds the previous simulated state with the current one (e.g on spawn or teleport), holding off interpolation until the next fixed step
+	void ResetFixedTimestepInterpolation();
+
+	/// @brief  Gathers the inputs the first CalculateVelocity of the next update is expected to run with, so the batch can integrate it ahead
+	///			through UMovementData::CalculateVelocities. Pending forces & impulses are folded into the gathered velocity
+	/// @return False if the velocity can't be batched (bound velocity, requested moves, root motion, pending launches, forces leaving the
+	///			ground or unbatchable movement data)
+	bool GatherBatchedVelocity(float DeltaTime);
+
+	/// @brief  Applies the batched velocity if CalculateVelocity is reached with the inputs it was integrated from. Anything changing them on
+	///			the way (e.g based movement or gameplay events) falls back to MovementData->CalculateVelocity. The batched velocity is only used once
+	/// @return True if the batched velocity was applied
+	bool ConsumeBatchedVelocity(float DeltaTime);
+
 	/// @brief  
 	/// @return True if we should continue with the movement updates
 	virtual bool PreMovementUpdate(float DeltaTime);
@@ -622,6 +813,9 @@ protected:
 
 	float GetSimulationTimeStep(float DeltaTime, uint32 Iterations) const;
 
+	/// @brief  Time step of the first iteration of the next simulated update given the time it runs over, accounting for the fixed timestep
+	float GetFirstSimulationTimeStep(float DeltaTime) const;
+
 	void RevertMove(const FVector& OldLocation, UPrimitiveComponent* OldBase, const FVector& InOldBaseLocation, const FGroundingStatus& OldFloor, bool bFailMove);
 	
 	void OnStuckInGeometry(const FHitResult* Hit);
@@ -657,6 +851,30 @@ protected:
 	///			Normally if @see bAlwaysCheckFloor is false, floor checks are avoided unless certain conditions are met. This overrides that to force a floor check.
 	UPROPERTY(Category="(Radical Movement): Ground Settings", VisibleInstanceOnly, BlueprintReadWrite, AdvancedDisplay)
 	uint8 bForceNextFloorCheck				: 1;
+
+	/// @brief	After each update while grounded, issues an async floor sweep from where the pawn is predicted to be on its next update.
+	///			The next floor check consumes it instead of sweeping if the pawn ended up within @see AsyncFloorProbeTolerance of that location,
+	///			and falls back to a synchronous sweep otherwise. Not used with @see bUseFlatBaseForFloorChecks
+	UPROPERTY(Category="(Radical Movement): Ground Settings", EditDefaultsOnly, AdvancedDisplay)
+	uint8 bUseAsyncFloorProbes				: 1;
+
+	/// @brief	Max distance between the predicted and actual location of the pawn for an async floor probe to be used
+	UPROPERTY(Category="(Radical Movement): Ground Settings", EditDefaultsOnly, AdvancedDisplay, meta=(EditCondition="bUseAsyncFloorProbes", ClampMin="0", UIMin="0", ForceUnits=cm))
+	float AsyncFloorProbeTolerance;
+
+	/// @brief	Reuses the last floor found instead of probing again as long as the capsule (its location, size, orientation and overlaps), gravity, and the
+	///			transform and collision of the floor primitive haven't changed. Lets idle or slowly moving pawns skip floor sweeps entirely.
+	///			Other primitives spawning or moving under the pawn aren't seen until the cache expires (FloorCacheMaxAge) or they overlap the capsule.
+	UPROPERTY(Category="(Radical Movement): Ground Settings", EditDefaultsOnly, AdvancedDisplay)
+	uint8 bUseFloorCache					: 1;
+
+	/// @brief	Max distance the capsule can move from where the cached floor was found before it has to be probed again
+	UPROPERTY(Category="(Radical Movement): Ground Settings", EditDefaultsOnly, AdvancedDisplay, meta=(EditCondition="bUseFloorCache", ClampMin="0", UIMin="0", ForceUnits=cm))
+	float FloorCacheDistanceThreshold;
+
+	/// @brief	Max time a cached floor is reused for before probing again, bounds how long new geometry under the pawn can go unnoticed
+	UPROPERTY(Category="(Radical Movement): Ground Settings", EditDefaultsOnly, AdvancedDisplay, meta=(EditCondition="bUseFloorCache", ClampMin="0", UIMin="0", ForceUnits=s))
+	float FloorCacheMaxAge;
 	// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
 public:
 	UPROPERTY(Category="(Radical Movement): Ground Status", VisibleInstanceOnly, BlueprintReadOnly)
@@ -680,11 +898,41 @@ protected:
 	virtual void FindFloor(const FVector& CapsuleLocation, FGroundingStatus& OutFloorResult, bool bCanUseCachedLocation, const FHitResult* DownwardSweepResult = nullptr) const;
 	bool FloorSweepTest(FHitResult& OutHit, const FVector& Start, const FVector& End, ECollisionChannel TraceChannel, const struct FCollisionShape& CollisionShape, const struct FCollisionQueryParams& Params, const struct FCollisionResponseParams& ResponseParams) const;
 
+	/// @brief	Floor probing distance used by FindFloor, accounting for the floor snapping height while grounded
+	float GetFloorProbeDistance() const;
+
+	/// @brief	Issues the async floor probe for the next update, @see bUseAsyncFloorProbes
+	void IssueAsyncFloorProbe(float DeltaTime);
+
+	void OnAsyncFloorProbeCompleted(const FTraceHandle& Handle, FTraceDatum& Data);
+
+	/// @brief	Retrieves the result of the async floor probe if it matches the sweep ComputeFloorDist is about to perform, moved to the given location.
+	///			The probe is discarded once used or rejected
+	/// @return	True if OutHit can be used in place of the sweep
+	bool ConsumeAsyncFloorProbe(const FVector& CapsuleLocation, float SweepRadius, float TraceDist, FHitResult& OutHit);
+
+	FAsyncFloorProbe AsyncFloorProbe;
+	FTraceDelegate AsyncFloorProbeDelegate;
+
+	/// @brief	Retrieves the cached floor if still valid for the given location, @see bUseFloorCache
+	bool GetCachedFloor(const FVector& CapsuleLocation, FGroundingStatus& OutFloorResult) const;
+
+	/// @brief	Caches the floor found at the given location, if it can be reused
+	void CacheFloor(const FVector& CapsuleLocation, const FGroundingStatus& FloorResult);
+
+	/// @brief	Hash of the primitives currently overlapping the capsule, the floor cache is invalidated when it changes
+	uint32 GetOverlapsHash() const;
+
+	FFloorCacheEntry FloorCache;
+
 	virtual bool IsValidLandingSpot(const FVector& CapsuleLocation, const FHitResult& Hit) const;
 	virtual bool ShouldCheckForValidLandingSpot(const FHitResult& Hit) const;
 
 	virtual void MaintainHorizontalGroundVelocity();
 
+	/// @brief  Velocity projected onto the floor keeping its direction on the plane against gravity, @see MaintainHorizontalGroundVelocity
+	FVector GetHorizontalGroundVelocity(const FVector& InVelocity) const;
+
 	void RecalculateVelocityToReflectMove(const FVector& OldLocation, const float DeltaTime);
 
 #pragma endregion Ground Stability Handling
@@ -891,6 +1139,16 @@ public:
 
 	/// @brief  Remove a RootMotionSource from current root motion by ID
 	void RemoveRootMotionSourceByID(uint16 RootMotionSourceID);
+
+	/// @brief  Gets a root motion source of type T from the pool to configure and pass to ApplyRootMotionSource. Sources are recycled once they've been removed from current root motion
+	template<class T>
+	TSharedPtr<T> NewRootMotionSource()
+	{
+		return RootMotionSourcePool.Acquire<T>();
+	}
+
+protected:
+	FRootMotionSourcePoolCFW RootMotionSourcePool;
 	
 
 #pragma endregion Root Motion
@@ -951,6 +1209,22 @@ protected:
 	UPROPERTY(Category= "(Radical Movement): Physics Interactions", EditAnywhere, BlueprintReadWrite, meta=(EditCondition="bEnablePhysicsInteraction", UIMin="-1.0", UIMax="1.0"))
 	float PushForcePointVerticalOffsetFactor;
 
+	/// @brief  Whether the pawn is pushed away from other pawns overlapping it, solved through the shared spatial hash of the URadicalMovementSubsystem.
+	///			Doesn't rely on overlap events, pawns only using them for crowd separation can disable them on their capsule.
+	UPROPERTY(Category= "(Radical Movement): Physics Interactions", EditDefaultsOnly)
+	uint8 bEnablePawnRepulsion					: 1;
+
+	/// @brief  Acceleration pushing the pawn away from a pawn fully overlapping it, scaled down linearly to 0 at the edge of the repulsion radius
+	UPROPERTY(Category= "(Radical Movement): Physics Interactions", EditAnywhere, BlueprintReadWrite, meta=(EditCondition="bEnablePawnRepulsion", ClampMin="0", UIMin="0", ForceUnits="cm/s^2"))
+	float PawnRepulsionStrength;
+
+	/// @brief  Scale of the capsule radius pawns start repelling each other at
+	UPROPERTY(Category= "(Radical Movement): Physics Interactions", EditAnywhere, BlueprintReadWrite, meta=(EditCondition="bEnablePawnRepulsion", ClampMin="0", UIMin="0"))
+	float PawnRepulsionRadiusScale;
+
+	/* Index in the subsystem's repulsion arrays, INDEX_NONE if not registered */
+	int32 RepulsionIndex;
+
 	
 	/// @brief Event invoked when the root collision component hits another collision component
 	/// @param OverlappedComponent 
@@ -971,6 +1245,7 @@ protected:
 
 	virtual void ApplyImpactPhysicsForces(const FHitResult& Impact, const FVector& ImpactAcceleration, const FVector& ImpactVelocity);
 	virtual void ApplyRepulsionForce(float DeltaTime);
+	virtual void ApplyPawnRepulsion(float DeltaTime);
 	virtual void ApplyDownwardForce(float DeltaTime);
 
 public:
@@ -1051,7 +1326,19 @@ public:
 	UFUNCTION(Category="Motor | Movement Base", BlueprintCallable)
 	virtual FVector GetImpartedMovementBaseVelocity() const;
 
+	/// @brief  Transform & velocities of the current movement base this frame, shared between the pawns based on it (@see URadicalMovementSubsystem)
+	FMovementBaseState GetMovementBaseState() const;
+
+	/// @brief  Move of the current movement base since SaveBaseLocation, shared between the pawns that saved the same base transform (@see URadicalMovementSubsystem)
+	FMovementBaseDelta GetMovementBaseDelta() const;
+
 	virtual void SaveBaseLocation();
+
+	/// @brief  Makes the movement update tick after the given base, through the batch tick function when batched (@see URadicalMovementSubsystem)
+	void AddMovementBaseTickDependency(UPrimitiveComponent* MovementBase);
+
+	/// @brief  Removes a dependency added through AddMovementBaseTickDependency
+	void RemoveMovementBaseTickDependency(UPrimitiveComponent* MovementBase);
 	
 protected:
 	void DecayFormerBaseVelocity(float DeltaTime);
@@ -1125,6 +1412,139 @@ protected:
 	//virtual void ShouldPerformAirControlForPathFollowing() const;
 #pragma endregion AI Path Following & RVO
 	
+/* Predicting where pawns will be without running the full simulation */
+#pragma region Trajectory Prediction
+public:
+	/// @brief  Predicts the pawn's trajectory over the next PredictionTime seconds by integrating its velocity with the current input (or requested move),
+	///			gravity, braking, air control and active root motion sources. Collision is ignored and the pawn keeps its current movement state throughout.
+	///			Velocities go through UMovementData::CalculateVelocities, so the arcade steering model (bAccelerationRotates) is approximated and
+	///			the top speed isn't carried between steps. Root motion sources are evaluated from the current location.
+	/// @param  NumSteps	Number of integration steps, evenly spaced in time
+	/// @param  OutSamples	One sample per step, the last one at PredictionTime
+	UFUNCTION(Category="Motor | Trajectory Prediction", BlueprintCallable)
+	void PredictTrajectory(float PredictionTime, int32 NumSteps, TArray<FPredictedTrajectorySample>& OutSamples) const;
+
+	/// @brief  PredictTrajectory for many pawns at once. Pawns sharing movement data integrate their velocities in a single batch,
+	///			only pawns with active root motion sources step them individually
+	/// @param  OutSamples	NumSteps samples per component, component major (samples of component i start at i * NumSteps). Left at zero for invalid components
+	static void PredictTrajectories(TConstArrayView<const URadicalMovementComponent*> Components, float PredictionTime, int32 NumSteps, TArray<FPredictedTrajectorySample>& OutSamples);
+#pragma endregion Trajectory Prediction
+	
+/* Reducing the update cost of less significant pawns */
+#pragma region Movement LOD
+protected:
+	/// @brief  Movement LOD tiers, from the most to the least significant. The first tier whose MaxDistance covers the significance of the pawn is used,
+	///			or the last one if none does. Leave empty to always update at full rate. Locally controlled players always use the first tier.
+	UPROPERTY(Category="(Radical Movement): Movement LOD", EditDefaultsOnly)
+	TArray<FMovementLODTier> MovementLODTiers;
+
+	/// @brief  Significance distance is scaled by this when the pawn was not recently rendered
+	UPROPERTY(Category="(Radical Movement): Movement LOD", EditDefaultsOnly, meta=(ClampMin="1", UIMin="1"))
+	float OffscreenLODDistanceScale;
+
+	/// @brief  Time between evaluations of the LOD tier
+	UPROPERTY(Category="(Radical Movement): Movement LOD", EditDefaultsOnly, meta=(ClampMin="0", UIMin="0", ForceUnits=s))
+	float MovementLODEvaluationInterval;
+
+	/// @brief  Updates that moved the pawn further than this are not smoothed (e.g teleports)
+	UPROPERTY(Category="(Radical Movement): Movement LOD", EditDefaultsOnly, meta=(ClampMin="0", UIMin="0", ForceUnits=cm))
+	float MaxMovementLODSmoothingDistance;
+
+	UPROPERTY(Category="(Radical Movement): Movement LOD", Transient, VisibleInstanceOnly)
+	int32 CurrentMovementLOD;
+
+	/// @brief  Tier forced through SetForcedMovementLOD, INDEX_NONE if not forced
+	int32 ForcedMovementLOD;
+
+	float MovementLODEvaluationTime;
+	float MovementLODAccumulatedTime;
+
+	FVector MovementLODSmoothingOffset;
+	float MovementLODSmoothingTime;
+	float MovementLODSmoothingDuration;
+	uint8 bMovementLODSmoothing : 1;
+
+public:
+	/// @brief  Current movement LOD tier, INDEX_NONE if no tiers are set
+	UFUNCTION(Category="Motor | Movement LOD", BlueprintPure)
+	FORCEINLINE int32 GetMovementLOD() const { return CurrentMovementLOD; }
+
+	/// @brief  Forces the movement LOD tier regardless of significance, INDEX_NONE to go back to evaluating it
+	UFUNCTION(Category="Motor | Movement LOD", BlueprintCallable)
+	void SetForcedMovementLOD(int32 Tier);
+
+	const FMovementLODTier* GetMovementLODTier() const
+	{
+		return MovementLODTiers.IsValidIndex(CurrentMovementLOD) ? &MovementLODTiers[CurrentMovementLOD] : nullptr;
+	}
+
+protected:
+	/// @brief  Significance used to pick the LOD tier, distance to the closest local viewer scaled by OffscreenLODDistanceScale when not rendered
+	virtual float CalculateMovementSignificance() const;
+
+	/// @brief  Re-evaluates the LOD tier once MovementLODEvaluationInterval has elapsed
+	void UpdateMovementLOD(float DeltaTime);
+
+	/// @brief  Accumulates time until the update interval of the current tier is reached. Input added on skipped frames is discarded
+	/// @param	InOutDeltaTime Frame time, set to the accumulated time to simulate when returning true
+	/// @return	True if the movement update should run this frame
+	bool ConsumeMovementLODTime(float& InOutDeltaTime);
+
+	/// @brief  Offsets the mesh back to where it was before the update, then eases it out over the update interval
+	void StartMovementLODSmoothing(const FVector& OldRootLocation);
+	void UpdateMovementLODSmoothing(float DeltaTime);
+
+	float GetMaxSimulationTimeStep() const;
+	int32 GetMaxSimulationIterations() const;
+#pragma endregion Movement LOD
+
+/* Offsetting the mesh from the capsule to hide reduced or fixed rate updates */
+#pragma region Mesh Visual Offset
+protected:
+	/* Visual offsets applied to the mesh relative to the capsule, @see ApplyMeshVisualOffset */
+	FVector MovementLODVisualOffset;
+	FVector FixedTimestepVisualOffset;
+	FQuat FixedTimestepVisualRotation;
+	uint8 bMeshVisualOffsetApplied : 1;
+
+	/// @brief  Offsets the mesh from its base translation and rotation by the LOD smoothing and fixed timestep interpolation offsets
+	void ApplyMeshVisualOffset();
+#pragma endregion Mesh Visual Offset
+
+/* Budgeting the scene queries issued per character, @see MovementQueryStats */
+#pragma region Scene Query Instrumentation
+protected:
+	/* Site the queries issued right now are attributed to, set through RMC_QUERY_SITE scopes */
+	EMovementQuerySite CurrentQuerySite;
+
+	/* Queries issued during the current update */
+	FMovementQueryCounts QueryCounts;
+	FMovementQueryCounts LastUpdateQueryCounts;
+	FMovementQueryCounts TotalQueryCounts;
+	uint32 NumQueryUpdates;
+
+	/// @brief  Counts queries of the given type against the current query site. Compiled out without RMC_QUERY_STATS
+	FORCEINLINE void CountSceneQuery(EMovementQueryType Type, uint32 Count = 1) const
+	{
+#if RMC_QUERY_STATS
+		const_cast<URadicalMovementComponent*>(this)->QueryCounts.Add(CurrentQuerySite, Type, Count);
+#endif
+	}
+
+	/// @brief  Closes the query counts of the update, reporting them to stats and trace
+	void FlushSceneQueryCounts();
+
+public:
+	/// @brief  Queries issued during the last movement update
+	FORCEINLINE const FMovementQueryCounts& GetLastUpdateQueryCounts() const { return LastUpdateQueryCounts; }
+
+	/// @brief  Queries issued since the last ResetSceneQueryCounts, over GetNumQueryUpdates updates
+	FORCEINLINE const FMovementQueryCounts& GetTotalQueryCounts() const { return TotalQueryCounts; }
+	FORCEINLINE uint32 GetNumQueryUpdates() const { return NumQueryUpdates; }
+
+	void ResetSceneQueryCounts();
+#pragma endregion Scene Query Instrumentation
+	
 /* Math shit or whatever helpers */
 #pragma region Utility
 
@@ -31,6 +31,7 @@ class COREFRAMEWORK_API UBufferedInputAction : public UInputAction
 	GENERATED_BODY()
 
 	friend class UInputBufferSubsystem;
+	friend struct FInputBufferBenchmark;
 
 public:
 
@@ -64,10 +65,36 @@ public:
 	TObjectPtr<UMotionMappingContext> DirectionalActionMap = nullptr;
 
 public:
+	/// @brief  Collects the input actions of the mappings and builds the lookup tables off of them. Done on load, call again if the
+	///			mappings are changed at runtime
 	void GenerateInputActions();
-	TArray<TObjectPtr<const UBufferedInputAction>> GetInputActions() const { return InputActions; }
-	FGameplayTagContainer GetActionIDs();
-	FGameplayTagContainer GetDirectionalIDs();
+	
+	const TArray<TObjectPtr<const UBufferedInputAction>>& GetInputActions() const { return InputActions; }
+	const FGameplayTagContainer& GetActionIDs() const { return ActionIDs; }
+	const FGameplayTagContainer& GetDirectionalIDs() const { return DirectionalIDs; }
+
+	/// @brief  Action IDs in the order of the input actions, an action's index is its position in this array
+	const TArray<FGameplayTag>& GetActionIDArray() const { return ActionIDArray; }
+	/// @brief  Directional IDs in the order of the directional mappings, a directional's index is its position in this array
+	const TArray<FGameplayTag>& GetDirectionalIDArray() const { return DirectionalIDArray; }
+
+	/// @brief  Index of each action ID in GetActionIDArray()
+	const TMap<FGameplayTag, int32>& GetActionIndices() const { return ActionIndices; }
+	/// @brief  Index of each directional ID in GetDirectionalIDArray()
+	const TMap<FGameplayTag, int32>& GetDirectionalIndices() const { return DirectionalIndices; }
+
+	/// @brief  Returns the input action with the given ID (exact match), null if it isn't mapped
+	const UBufferedInputAction* FindInputAction(const FGameplayTag& InputID) const
+	{
+		const int32* Index = ActionIndices.Find(InputID);
+		return Index ? InputActions[*Index].Get() : nullptr;
+	}
+
+	virtual void PostLoad() override;
+	
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 
 private:
 	UPROPERTY(Transient)
@@ -78,6 +105,12 @@ private:
 
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<const UBufferedInputAction>> InputActions;
+
+	/* Lookup tables, built along with the input actions */
+	TArray<FGameplayTag> ActionIDArray;
+	TArray<FGameplayTag> DirectionalIDArray;
+	TMap<FGameplayTag, int32> ActionIndices;
+	TMap<FGameplayTag, int32> DirectionalIndices;
 };
 
 
@@ -91,8 +124,10 @@ class COREFRAMEWORK_API UMotionMappingContext : public UDataAsset
 {
 	GENERATED_BODY()
 
+	friend struct FInputBufferBenchmark;
+
 public:
-	FORCEINLINE TArray<TObjectPtr<UMotionAction>> GetMappings() { return Mapping; }
+	FORCEINLINE const TArray<TObjectPtr<UMotionAction>>& GetMappings() const { return Mapping; }
 
 	FORCEINLINE FGameplayTag GetDirectionalActionID() const
 	{
@@ -144,6 +179,8 @@ class COREFRAMEWORK_API UMotionAction : public UDataAsset
 	GENERATED_BODY()
 
 	friend class UInputBufferSubsystem;
+	friend struct FMotionCommandAutomaton;
+	friend struct FInputBufferBenchmark;
 	
 protected:
 
@@ -217,6 +254,9 @@ public:
 	
 	EMotionCommandDirection GetAxisDirection(const FVector2D& AxisInput, const FVector& ProcessedInput, const FVector& PlayerForward, const FVector& PlayerRight) const;
 
+	/// @brief  Classifies a (non-zero) input vector into a command direction relative to the given basis
+	static EMotionCommandDirection ClassifyAxisDirection(const FVector& ProperAxisInput, const FVector& EvaluationDirection, const FVector& RightDirection);
+
 	FORCEINLINE FVector2D GetFromDirection() const
 	{
 		switch (FromDirection)
@@ -261,6 +301,52 @@ public:
 	
 };
 
+/// @brief	MotionCommandSequence of a UMotionAction compiled into a state machine, state (N) meaning the first N steps of the
+///			sequence have been matched. Stepped once per buffer frame with that frames direction, classified once for all motion actions.
+///			Angle change actions aren't sequences, those still defer to UMotionAction::CheckMotionDirection.
+struct COREFRAMEWORK_API FMotionCommandAutomaton
+{
+	static constexpr int32 NumDirections = 5;
+	
+	/// @brief	Compiles the command sequence of the given action
+	void Compile(UMotionAction* InAction);
+
+	/// @brief	Resets the transient state that is checked during the buffer window
+	void Reset();
+
+	/// @brief	Steps the automaton with the direction of the next (newer) frame
+	/// @return	True if the whole sequence had already been matched before this frame
+	FORCEINLINE bool Step(const EMotionCommandDirection Direction)
+	{
+		if (State == AcceptState) return true;
+		State = Transitions[State * NumDirections + Direction];
+		return false;
+	}
+
+	FORCEINLINE bool IsValid() const { return Action != nullptr && (bAngleChange || AcceptState > 0); }
+	
+public:
+	/// @brief	Action this was compiled from
+	UMotionAction* Action = nullptr;
+	
+	FGameplayTag InputID;
+
+	/// @brief	Slot of the action in the input buffer's directional tracking data, assigned by the input buffer
+	int32 DirectionalSlot = INDEX_NONE;
+
+	bool bAngleChange = false;
+	bool bRelativeToPlayer = false;
+
+	/// @brief	Next state for each (State, Direction) pair
+	TArray<uint8> Transitions;
+	
+	uint8 AcceptState = 0;
+
+	/* Transient evaluation state */
+	uint8 State = 0;
+	int8 ValidFrame = -1;
+};
+
 #pragma endregion Directional Input Definitions
 
 
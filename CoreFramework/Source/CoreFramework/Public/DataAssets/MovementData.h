@@ -25,6 +25,31 @@ enum ERotationMethod
 	METHOD_ControllerDesiredRotation	UMETA(DisplayName="Orient To Controller")
 };
 
+/* Per character state consumed by UMovementData::CalculateVelocities, every view holds one entry per character */
+struct COREFRAMEWORK_API FMovementVelocityBatch
+{
+	/* Velocity before the update, overwritten with the integrated velocity */
+	TArrayView<FVector> Velocities;
+
+	/* @see UMovementData::ComputeInputAcceleration */
+	TConstArrayView<FVector> Accelerations;
+	
+	TConstArrayView<FVector> Gravities;
+	TConstArrayView<FVector> GravityDirs;
+
+	/* Terminal velocity of the physics volume each character is in */
+	TConstArrayView<float> TerminalVelocities;
+	
+	TConstArrayView<EMovementState> MovementStates;
+
+	FORCEINLINE int32 Num() const { return Velocities.Num(); }
+
+	FORCEINLINE bool IsValid() const
+	{
+		return Accelerations.Num() == Num() && Gravities.Num() == Num() && GravityDirs.Num() == Num() && TerminalVelocities.Num() == Num() && MovementStates.Num() == Num();
+	}
+};
+
 /**
  * 
  */
@@ -193,6 +218,19 @@ public:
 	
 	void ApplyGravity(const URadicalMovementComponent* MovementComponent, FVector& Velocity, float TerminalLimit, float DeltaTime) const;
 
+	/// @brief  Whether CalculateVelocities reproduces the velocity model of this asset. Arcadey acceleration isn't batched,
+	///			subclasses overriding CalculateInputVelocity should return false so their characters keep going through CalculateVelocity
+	virtual bool CanCalculateVelocitiesInBatch() const { return !bAccelerationRotates; }
+
+	/// @brief  Whether CalculateVelocities of this asset integrates the same velocities as the other one, i.e both are the same class and
+	///			share every parameter the batch reads. Characters whose assets match can go through a single CalculateVelocities
+	bool HasSameVelocityModel(const UMovementData* Other) const;
+
+	/// @brief  CalculateVelocity for every character of the batch at once, 4 characters per SIMD register with the per state friction & braking resolved once for the whole batch.
+	///			Requested moves (path following) aren't applied and InstanceTopSpeed isn't written back, characters relying on either should use CalculateVelocity.
+	///			Assets that can't calculate velocities in batch are integrated with the friction based model, which is only good enough for approximations (e.g trajectory prediction)
+	void CalculateVelocities(const FMovementVelocityBatch& Batch, float DeltaTime) const;
+
 //protected:
 	virtual void CalculateInputVelocity(URadicalMovementComponent* MovementComponent, FVector& Velocity, FVector& Acceleration, float Friction, float BrakingDeceleration, float DeltaTime) const;
 	virtual void CalculateArcadeyInputVelocity(URadicalMovementComponent* MovementComponent, FVector& Velocity, FVector& Acceleration, float Friction, float BrakingDeceleration, float DeltaTime) const;
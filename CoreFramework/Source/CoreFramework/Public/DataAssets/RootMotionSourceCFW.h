@@ -71,6 +71,43 @@ protected:
 
 };
 
+/**
+ *  Recycles root motion sources by type. A source is free again once the pool holds its only reference (i.e the group dropped it after it finished),
+ *  so applying and removing sources doesn't allocate once the pool has warmed up to the number of concurrent sources of each type.
+ */
+struct COREFRAMEWORK_API FRootMotionSourcePoolCFW
+{
+	/** Returns a free source of type T reset to its defaults, allocating only if every pooled source of that type is in use */
+	template<class T>
+	TSharedPtr<T> Acquire()
+	{
+		static_assert(TIsDerivedFrom<T, FRootMotionSourceCFW>::Value, "Pooled root motion sources must derive from FRootMotionSourceCFW");
+
+		TArray<TSharedPtr<FRootMotionSourceCFW>>& Sources = Pools.FindOrAdd(T::StaticStruct());
+		for (const TSharedPtr<FRootMotionSourceCFW>& Source : Sources)
+		{
+			if (Source.GetSharedReferenceCount() == 1)
+			{
+				TSharedPtr<T> Recycled = StaticCastSharedPtr<T>(Source);
+				*Recycled = T();
+				return Recycled;
+			}
+		}
+
+		TSharedPtr<T> NewSource = MakeShared<T>();
+		Sources.Add(NewSource);
+		return NewSource;
+	}
+
+	/** Number of pooled sources, in use or not */
+	int32 Num() const;
+
+	void Empty() { Pools.Empty(); }
+
+private:
+	TMap<const UScriptStruct*, TArray<TSharedPtr<FRootMotionSourceCFW>>> Pools;
+};
+
 /** ConstantForce applies a fixed force to the target */
 USTRUCT()
 struct COREFRAMEWORK_API FRootMotionSourceCFW_ConstantForce : public FRootMotionSourceCFW
@@ -288,11 +325,38 @@ struct COREFRAMEWORK_API FRootMotionSourceCFW_MoveToDynamicForce : public FRootM
 };
 
 
+/**
+ *  Baked jump path, positions and tangents (per unit time fraction) at evenly spaced time fractions. Assigning to it copies into the allocation it already has,
+ *  so a pooled jump force reset to its defaults (@see FRootMotionSourcePoolCFW::Acquire) keeps its storage for the next bake.
+ */
+struct FRootMotionJumpPathCFW
+{
+	TArray<FVector3f> Positions;
+	TArray<FVector3f> Tangents;
+
+	FRootMotionJumpPathCFW() = default;
+	FRootMotionJumpPathCFW(const FRootMotionJumpPathCFW&) = default;
+
+	FRootMotionJumpPathCFW& operator=(const FRootMotionJumpPathCFW& Other)
+	{
+		if (this != &Other)
+		{
+			Positions.Reset(Other.Positions.Num());
+			Positions.Append(Other.Positions);
+			Tangents.Reset(Other.Tangents.Num());
+			Tangents.Append(Other.Tangents);
+		}
+		return *this;
+	}
+};
+
 USTRUCT()
 struct COREFRAMEWORK_API FRootMotionSourceCFW_JumpForce : public FRootMotionSourceCFW
 {
 	GENERATED_BODY()
 
+	friend class FRootMotionTaskPoolTest;
+
 	FRootMotionSourceCFW_JumpForce();
 
 	virtual ~FRootMotionSourceCFW_JumpForce() {}
@@ -321,6 +385,30 @@ struct COREFRAMEWORK_API FRootMotionSourceCFW_JumpForce : public FRootMotionSour
 
 	FVector GetRelativeLocation(float MoveFraction) const;
 
+	/** Location along the path in facing space at a 0-1 fraction of the duration (time mapping applied), from the baked path if curves shape it */
+	FVector GetPathLocation(float TimeFraction) const;
+
+protected:
+	/**
+	 * Samples TimeMappingCurve & PathOffsetCurve over the duration so preparing the source is a single path lookup. Done on first prepare since the source is configured after construction.
+	 * The segment count is doubled until the midpoint of every segment is within cfw.RootMotion.JumpForce.PathMaxError of the unbaked path (bounded by MaxPathSegments),
+	 * paths that can't meet it (stepped curves) aren't baked and are evaluated directly
+	 */
+	void BakePath();
+
+	/** Location along the unbaked path in facing space */
+	FVector EvaluatePath(float TimeFraction) const;
+
+	/* Baked path in facing space evaluated as cubic Hermite segments. Unused when the default parabola is used, which is evaluated directly */
+	static constexpr int32 MaxPathSegments = 256;
+	FRootMotionJumpPathCFW Path;
+	int32 NumPathSegments = 0;
+
+	FQuat FacingQuat = FQuat::Identity;
+	bool bPathBaked = false;
+
+public:
+
 	virtual bool IsTimeOutEnabled() const override;
 
 	virtual FRootMotionSource* Clone() const override;
@@ -2,19 +2,17 @@
 
 #pragma once
 
+#include <atomic>
+
 /**
- * Implements a lock-free first-in first-out queue using a circular array.
+ * Implements a double ended ring buffer using a circular array.
  *
- * This class is thread safe only in single-producer single-consumer scenarios.
+ * Pushing into a full buffer overwrites the element on the opposite end, so the buffer always holds
+ * the most recent (Capacity) elements.
  *
- * The number of items that can be enqueued is one less than the queue's capacity,
- * because one item will be used for detecting full and empty states.
+ * This class is NOT thread safe, see TSpscBufferContainer to hand elements between two threads.
  *
- * There is some room for optimization via using fine grained memory fences, but
- * the implications for all of our target platforms need further analysis, so
- * we're using the simpler sequentially consistent model for now.
- *
- * @param T The type of elements held in the queue.
+ * @param T The type of elements held in the buffer.
  */
 template<typename T>
 class COREFRAMEWORK_API TBufferContainer
@@ -38,7 +36,7 @@ public:
 	}
 
 	/* Getter */
-	FORCEINLINE FElementType operator[](uint32 Index) const
+	FORCEINLINE const FElementType& operator[](uint32 Index) const
 	{
 		return Buffer[InternalIndex(Index)];
 	}
@@ -64,6 +62,23 @@ public:
 		}
 	}
 
+	/// @brief	Moves the front of the queue back by one without copying an item in. When full, the element that falls off
+	///			the back is handed out as the new front so its storage can be overwritten in place instead of reallocated.
+	/// @return	The new front element (holds whatever was last stored in that slot)
+	FElementType& AdvanceFront()
+	{
+		Decrement(Start);
+		if (IsFull())
+		{
+			End = Start;
+		}
+		else
+		{
+			++Size;
+		}
+		return Buffer[Start];
+	}
+
 	void PushBack(FElementType Item)
 	{
 		if (IsFull())
@@ -111,9 +126,9 @@ public:
 
 	FORCEINLINE bool IsFull() const { return Size == Capacity; }
 
-	FElementType Front() const { return Buffer[Start]; }
+	const FElementType& Front() const { return Buffer[Start]; }
 
-	FElementType Back() const { return Buffer[(End != 0 ? End : Capacity) - 1]; }
+	const FElementType& Back() const { return Buffer[(End != 0 ? End : Capacity) - 1]; }
 
 protected:
 
@@ -141,3 +156,106 @@ protected:
 	uint32 End;
 	uint32 Size;
 };
+
+
+/**
+ * Implements a lock-free first-in first-out queue using a circular array.
+ *
+ * This class is thread safe only in single-producer single-consumer scenarios: Push may only be called from the
+ * producer thread and Peek/Pop from the consumer thread. Each index is only written by its own side, elements are
+ * published with a release store of the tail and reclaimed with a release store of the head.
+ *
+ * Unlike TBufferContainer a full queue rejects new elements instead of overwriting, the consumer might still be
+ * reading the oldest element.
+ *
+ * @param T The type of elements held in the queue.
+ */
+template<typename T>
+class TSpscBufferContainer
+{
+public:
+	using FElementType = T;
+
+	/* One slot is kept empty to tell a full queue from an empty one */
+	explicit TSpscBufferContainer(uint32 BufferCapacity) : Capacity(BufferCapacity + 1), Head(0), Tail(0)
+	{
+		Buffer.SetNum(Capacity);
+	}
+
+	TSpscBufferContainer(const TSpscBufferContainer&) = delete;
+	TSpscBufferContainer& operator=(const TSpscBufferContainer&) = delete;
+
+	/// @brief	[Producer] Adds an element to the back of the queue
+	/// @return	False if the queue is full, the element isn't added
+	template<typename ItemType>
+	bool Push(ItemType&& Item)
+	{
+		const uint32 CurrentTail = Tail.load(std::memory_order_relaxed);
+		const uint32 NextTail = Next(CurrentTail);
+		
+		// Acquire pairs with the consumer's release of Head, the slot is only reused once the consumer is done reading it
+		if (NextTail == Head.load(std::memory_order_acquire)) return false;
+
+		Buffer[CurrentTail] = Forward<ItemType>(Item);
+		Tail.store(NextTail, std::memory_order_release);
+		return true;
+	}
+
+	/// @brief	[Consumer] Returns the front element without removing it, null if the queue is empty
+	const FElementType* Peek() const
+	{
+		const uint32 CurrentHead = Head.load(std::memory_order_relaxed);
+		
+		// Acquire pairs with the producer's release of Tail, making the element's write visible
+		if (CurrentHead == Tail.load(std::memory_order_acquire)) return nullptr;
+		
+		return &Buffer[CurrentHead];
+	}
+
+	/// @brief	[Consumer] Removes the front element from the queue
+	/// @return	False if the queue is empty
+	bool Pop(FElementType& OutItem)
+	{
+		const uint32 CurrentHead = Head.load(std::memory_order_relaxed);
+		if (CurrentHead == Tail.load(std::memory_order_acquire)) return false;
+
+		OutItem = MoveTemp(Buffer[CurrentHead]);
+		Head.store(Next(CurrentHead), std::memory_order_release);
+		return true;
+	}
+
+	/// @brief	[Consumer] Removes the front element from the queue
+	/// @return	False if the queue is empty
+	bool Pop()
+	{
+		const uint32 CurrentHead = Head.load(std::memory_order_relaxed);
+		if (CurrentHead == Tail.load(std::memory_order_acquire)) return false;
+
+		Head.store(Next(CurrentHead), std::memory_order_release);
+		return true;
+	}
+
+	FORCEINLINE int GetCapacity() const { return Capacity - 1; }
+
+	/// @brief	Number of elements in the queue, only exact when called while the other side is idle
+	int GetSize() const
+	{
+		const uint32 CurrentHead = Head.load(std::memory_order_acquire);
+		const uint32 CurrentTail = Tail.load(std::memory_order_acquire);
+		return CurrentTail >= CurrentHead ? CurrentTail - CurrentHead : Capacity - CurrentHead + CurrentTail;
+	}
+
+	FORCEINLINE bool IsEmpty() const { return Head.load(std::memory_order_acquire) == Tail.load(std::memory_order_acquire); }
+
+protected:
+	FORCEINLINE uint32 Next(const uint32 Index) const { return Index + 1 == Capacity ? 0 : Index + 1; }
+
+	/* Holds the buffer */
+	TArray<FElementType> Buffer;
+
+	const uint32 Capacity;
+
+	/* Indices live on their own cache lines, each is written by a different thread */
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> Head;
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> Tail;
+};
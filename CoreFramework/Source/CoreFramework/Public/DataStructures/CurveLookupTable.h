@@ -0,0 +1,32 @@
+﻿// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/* Forward Declarations */
+class UCurveBase;
+class UCurveFloat;
+class UCurveVector;
+
+/**
+ * Curve assets baked into uniformly sampled lookup tables, evaluated with a single linear interpolation instead of the rich curve key search.
+ *
+ * Tables are baked on first use and shared by everything sampling the same asset. The sample count is doubled until interpolating
+ * between samples stays within cfw.RootMotion.CurveLUT.MaxError of the curve (bounded by cfw.RootMotion.CurveLUT.MaxSamples).
+ * Times outside of the curve's key range fall back to the curve itself so extrapolation is preserved, as do curves with constant keys
+ * or keys sharing a time since their steps can't be interpolated.
+ * Tables are rebaked when the asset is modified in editor, and dropped once the asset is garbage collected. Game thread only.
+ */
+namespace CurveLUT
+{
+	COREFRAMEWORK_API float EvaluateFloat(const UCurveFloat& Curve, float Time);
+	COREFRAMEWORK_API FVector EvaluateVector(const UCurveVector& Curve, float Time);
+
+	/// @brief  Evaluates the curve at a 0-1 fraction of its key range
+	COREFRAMEWORK_API float EvaluateFloatAtFraction(const UCurveFloat& Curve, float Fraction);
+	COREFRAMEWORK_API FVector EvaluateVectorAtFraction(const UCurveVector& Curve, float Fraction);
+
+	/// @brief  Drops the table of the curve so it's rebaked on next use, or every table if Curve is null
+	COREFRAMEWORK_API void Invalidate(const UCurveBase* Curve = nullptr);
+}
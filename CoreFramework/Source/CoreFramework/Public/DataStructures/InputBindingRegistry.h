@@ -0,0 +1,191 @@
+﻿// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+/* Binding gathered for evaluation, ordered by priority (and insertion order among equal priorities) */
+struct FGatheredInputBinding
+{
+	int32 Priority;
+	uint32 Order;
+	int32 ID;
+
+	bool operator<(const FGatheredInputBinding& Other) const
+	{
+		return Priority != Other.Priority ? Priority > Other.Priority : Order < Other.Order;
+	}
+};
+
+/**
+ * Holds input buffer bindings of a single type, indexed by the input tags they depend on.
+ *
+ * Each tag keeps the bindings depending on it sorted by priority, new bindings are inserted in place
+ * instead of re-sorting every binding. Evaluation then only gathers the bindings of the tags whose
+ * buffer state changed, along with any binding that was added since it last gathered. Every list is
+ * kept sorted the same way, so gathering merges them instead of appending & re-sorting.
+ *
+ * Continuous bindings are gathered on every evaluation, regardless of whether their inputs changed. These are the
+ * bindings that fire for as long as their input state holds (holds, and bindings that don't consume their input),
+ * so they keep firing on every evaluation as they did before evaluation was driven by state changes.
+ *
+ * @param BindingType The FInputBufferBinding type held, identified by its Handle.
+ * @param HandleType The delegate handle describing how the binding is triggered.
+ */
+template<typename BindingType, typename HandleType>
+class TInputBindingRegistry
+{
+public:
+	struct FEntry
+	{
+		BindingType Binding;
+		HandleType Handle;
+		FGameplayTag Tags[2];
+		int32 Priority = 0;
+		uint32 Order = 0;
+		bool bContinuous = false;
+	};
+
+	/// @brief	Adds a binding (replacing it if it was already added) and indexes it under the given tags
+	/// @param	bContinuous Whether the binding is gathered on every evaluation instead of only when its inputs change
+	void Add(const BindingType& Binding, const HandleType& Handle, const int32 Priority, const bool bContinuous, const FGameplayTag& FirstTag, const FGameplayTag& SecondTag = FGameplayTag())
+	{
+		Remove(Binding);
+
+		FEntry& Entry = Entries.Add(Binding.Handle);
+		Entry.Binding = Binding;
+		Entry.Handle = Handle;
+		Entry.Tags[0] = FirstTag;
+		Entry.Tags[1] = SecondTag != FirstTag ? SecondTag : FGameplayTag();
+		Entry.Priority = Priority;
+		Entry.Order = NextOrder++;
+		Entry.bContinuous = bContinuous;
+
+		const FGatheredInputBinding Indexed = { Priority, Entry.Order, Binding.Handle };
+		if (bContinuous) InsertSorted(ContinuousBindings, Indexed);
+		
+		for (const FGameplayTag& Tag : Entry.Tags)
+		{
+			if (Tag.IsValid()) InsertSorted(TagBindings.FindOrAdd(Tag), Indexed);
+		}
+
+		InsertSorted(PendingBindings, Indexed);
+	}
+
+	/// @brief	Removes a binding and drops it from its tags
+	bool Remove(const BindingType& Binding)
+	{
+		const FEntry* Entry = Entries.Find(Binding.Handle);
+		if (!Entry) return false;
+
+		for (const FGameplayTag& Tag : Entry->Tags)
+		{
+			if (!Tag.IsValid()) continue;
+
+			if (TArray<FGatheredInputBinding>* TagList = TagBindings.Find(Tag))
+			{
+				TagList->RemoveAll([&Binding](const FGatheredInputBinding& Indexed) { return Indexed.ID == Binding.Handle; });
+			}
+		}
+
+		if (Entry->bContinuous)
+		{
+			ContinuousBindings.RemoveAll([&Binding](const FGatheredInputBinding& Indexed) { return Indexed.ID == Binding.Handle; });
+		}
+
+		Entries.Remove(Binding.Handle);
+		return true;
+	}
+
+	void Empty()
+	{
+		Entries.Empty();
+		TagBindings.Empty();
+		PendingBindings.Empty();
+		ContinuousBindings.Empty();
+	}
+
+	/// @brief	Gathers (in priority order) the bindings that depend on any of the given tags, the continuous bindings and the ones added since the last gather
+	void Gather(const TArray<FGameplayTag>& DirtyTags, TArray<FGatheredInputBinding>& OutBindings)
+	{
+		OutBindings.Reset();
+
+		GatherCursors.Reset();
+		AddGatherCursor(ContinuousBindings);
+		for (const FGameplayTag& Tag : DirtyTags)
+		{
+			if (const TArray<FGatheredInputBinding>* TagList = TagBindings.Find(Tag)) AddGatherCursor(*TagList);
+		}
+		AddGatherCursor(PendingBindings);
+
+		// Merges the lists, taking the highest priority head among them each step. Only a few lists are gathered at once, so the heads are scanned
+		while (!GatherCursors.IsEmpty())
+		{
+			int32 Next = 0;
+			for (int32 i = 1; i < GatherCursors.Num(); i++)
+			{
+				if (*GatherCursors[i].Current < *GatherCursors[Next].Current) Next = i;
+			}
+
+			// A binding can be gathered through both of its tags (or while pending), its copies come out of the merge back to back
+			FGatherCursor& Cursor = GatherCursors[Next];
+			if (OutBindings.IsEmpty() || OutBindings.Last().ID != Cursor.Current->ID)
+			{
+				OutBindings.Add(*Cursor.Current);
+			}
+			
+			if (++Cursor.Current == Cursor.End) GatherCursors.RemoveAtSwap(Next, 1, false);
+		}
+
+		PendingBindings.Reset();
+	}
+
+	FORCEINLINE FEntry* Find(const int32 ID) { return Entries.Find(ID); }
+
+	FORCEINLINE bool Contains(const BindingType& Binding) const { return Entries.Contains(Binding.Handle); }
+
+	FORCEINLINE int32 Num() const { return Entries.Num(); }
+
+	FORCEINLINE bool HasPendingBindings() const { return !PendingBindings.IsEmpty(); }
+
+	FORCEINLINE bool HasContinuousBindings() const { return !ContinuousBindings.IsEmpty(); }
+
+protected:
+	/* Read position in one of the gathered lists */
+	struct FGatherCursor
+	{
+		const FGatheredInputBinding* Current;
+		const FGatheredInputBinding* End;
+	};
+	
+	/// @brief	Inserts a binding into a sorted list, right after every binding with the same or a higher priority
+	static void InsertSorted(TArray<FGatheredInputBinding>& List, const FGatheredInputBinding& Indexed)
+	{
+		int32 Index = List.Num();
+		while (Index > 0 && Indexed < List[Index - 1]) Index--;
+		List.Insert(Indexed, Index);
+	}
+
+	void AddGatherCursor(const TArray<FGatheredInputBinding>& List)
+	{
+		if (!List.IsEmpty()) GatherCursors.Add({ List.GetData(), List.GetData() + List.Num() });
+	}
+	
+	/* Bindings, keyed by their binding handle */
+	TMap<int32, FEntry> Entries;
+
+	/* Bindings depending on each input tag, sorted by priority */
+	TMap<FGameplayTag, TArray<FGatheredInputBinding>> TagBindings;
+
+	/* Bindings added since the last gather, evaluated regardless of whether their input changed */
+	TArray<FGatheredInputBinding> PendingBindings;
+
+	/* Bindings gathered on every evaluation, sorted by priority */
+	TArray<FGatheredInputBinding> ContinuousBindings;
+
+	/* Scratch cursors of the lists being merged, kept to not reallocate on every gather */
+	TArray<FGatherCursor> GatherCursors;
+
+	uint32 NextOrder = 0;
+};
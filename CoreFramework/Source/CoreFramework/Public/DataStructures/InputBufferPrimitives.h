@@ -44,6 +44,11 @@ public:
 	void SetActionValue(const FInputActionValue InValue) { AssociatedVal = InValue; }
 	bool IsConsumed() const { return bPressInstanceConsumed; }
 	
+	bool Equals(const FBufferState& Other) const
+	{
+		return FrameVal == Other.FrameVal && HoldTime == Other.HoldTime && bPressInstanceConsumed == Other.bPressInstanceConsumed;
+	}
+	
 	bool IsPress() const { return FrameVal >= 0 && HoldTime == 0 && bPressInstanceConsumed == false; }
 	bool IsHold() const { return FrameVal >= 0 && HoldTime > 0; }// && bPressInstanceConsumed == true; }
 	bool IsRelease() const { return FrameVal >= 0 && HoldTime < 0; } // && bPressInstanceConsumed == true; }
@@ -68,6 +73,9 @@ public:
 	explicit FRawInputValue(const FInputActionInstance& ValueInstance)
 				: InputValue(ValueInstance.GetValue()), ElapsedTriggeredTime(ValueInstance.GetTriggeredTime()) {}
 	
+	FRawInputValue(const FInputActionValue& InValue, const float InTriggeredTime)
+				: InputValue(InValue), ElapsedTriggeredTime(InTriggeredTime) {}
+	
 	// General accessors
 	bool IsThereInput() const { return InputValue.IsNonZero(); }
 	FInputActionValue GetValue() const { return InputValue; }
@@ -77,6 +85,14 @@ public:
 	float GetTriggeredTime() const { return ElapsedTriggeredTime; }
 };
 
+/* Raw input value of an action slot, stamped with the platform time it was received at (see UInputBufferSettings::bTimestampedSampling) */
+struct COREFRAMEWORK_API FTimestampedRawInput
+{
+	double Timestamp = 0.0;
+	int32 Slot = INDEX_NONE;
+	FRawInputValue Value;
+};
+
 /// @brief	Container to hold two frame states to account for a sequence of the same action
 ///			NOTE: If any input is actually registered, the older frame is guaranteed to be valid but not the newer frame
 ///			(NewerState is only checked whenever there's a binding for Action Sequence where both actions are of the same input)
@@ -108,18 +124,78 @@ struct COREFRAMEWORK_API FBufferStateTuple
 	}
 
 	bool IsEitherPress() const { return OlderState.IsPress() || NewerState.IsPress(); }
+
+	bool Equals(const FBufferStateTuple& Other) const { return OlderState.Equals(Other.OlderState) && NewerState.Equals(Other.NewerState); }
+};
+
+/// @brief	Incrementally maintained summary of a single input across the button window, bit (N) corresponds to buffer frame (N).
+///			Only one frame enters and one leaves the window per buffer tick, so the masks are shifted instead of rescanning the window.
+///			Limited to windows of 64 frames.
+struct COREFRAMEWORK_API FButtonFrameTracker
+{
+	/// @brief	Frames in which the input can invoke a press
+	uint64 PressMask = 0;
+	/// @brief	Frames in which the input can invoke a press, hold or release
+	uint64 EventMask = 0;
+	/// @brief	Frames in which the input has been consumed
+	uint64 UsedMask = 0;
+	/// @brief	Frames in which the input was released, consuming a press doesn't propagate past them
+	uint64 ReleaseMask = 0;
+
+	void Reset()
+	{
+		PressMask = 0;
+		EventMask = 0;
+		UsedMask = 0;
+		ReleaseMask = 0;
+	}
+
+	/// @brief	Shifts every tracked frame one frame older and registers the new front frame
+	void Advance(const uint64 WindowMask, const bool bPress, const bool bEvent, const bool bUsed, const bool bRelease)
+	{
+		PressMask = ((PressMask << 1) | (bPress ? 1 : 0)) & WindowMask;
+		EventMask = ((EventMask << 1) | (bEvent ? 1 : 0)) & WindowMask;
+		UsedMask = (UsedMask << 1) | (bUsed ? 1 : 0);
+		ReleaseMask = (ReleaseMask << 1) | (bRelease ? 1 : 0);
+	}
+
+	/// @brief	Consumes the input from frame (FromFrame) up to the newest frame, stopping at the first release after it. Consumed
+	///			presses no longer invoke any event.
+	/// @return	Mask of the frames consumed
+	uint64 Consume(const int32 FromFrame)
+	{
+		if (FromFrame < 0 || FromFrame >= 64) return 0;
+		
+		uint64 Consumed = FromFrame == 63 ? MAX_uint64 : (1ull << (FromFrame + 1)) - 1;
+		if (const uint64 Releases = ReleaseMask & Consumed)
+		{
+			Consumed &= ~((2ull << FMath::FloorLog2_64(Releases)) - 1); // Stops at the first release following FromFrame (the oldest release in range)
+		}
+
+		const uint64 ConsumedPresses = PressMask & Consumed;
+		PressMask &= ~ConsumedPresses;
+		EventMask &= ~ConsumedPresses;
+		UsedMask |= Consumed;
+		return Consumed;
+	}
+
+	/// @brief	True if the input has been consumed on the given frame (only frames < 64 are tracked)
+	bool IsUsed(const int32 Frame) const { return Frame >= 0 && Frame < 64 && (UsedMask >> Frame) & 1; }
+
+	/// @brief	Oldest frame in the window that can invoke a press, (-1) if none
+	int8 GetOldestPress() const { return PressMask ? static_cast<int8>(FMath::FloorLog2_64(PressMask)) : -1; }
+
+	/// @brief	Newest frame in the window that can invoke any event, (-1) if none
+	int8 GetNewestEvent() const { return EventMask ? static_cast<int8>(FMath::CountTrailingZeros64(EventMask)) : -1; }
 };
 
-/* Struct defining the state of a given input in a frame, whether its been used, being held, and so on  */
+/* Snapshot of the state of a given input in a frame, whether its been used, being held, and so on  */
 USTRUCT()
 struct COREFRAMEWORK_API FInputFrameState
 {
 	GENERATED_BODY()
 
 public:
-	/// @brief	Input Action ID Associated With This Object
-	FGameplayTag ID;
-	
 	/// @brief  Register the raw input action value from EIC into this frame state
 	FInputActionValue Value;
 	
@@ -133,54 +209,94 @@ public:
 	/// @brief  Used to keep track of a release event being invoked so it doesnt linger in the buffer
 	bool bReleaseFlagged{false};
 
-	float DebugTime{0};
 public:
 	FInputFrameState() {};
-	explicit FInputFrameState(const FGameplayTag& InputID) : ID(InputID) {};
-	
-	/// @brief Checks the assigned input and resolves its state (Held, Released, Axis, etc...)
-	void ResolveCommand(const TMap<FGameplayTag, FRawInputValue>& RawValueContainer);
-
-	/// @brief Called when the input is being held
-	/// @param InValue Current value of the input in seconds
-	void HoldUp(const FInputActionValue InValue);
-	
-	/// @brief Called when the assigned input has been released or has not been registered
-	void ReleaseHold(const FInputActionValue InValue);
 
 	/// @brief  Returns true if the current frame state has not been used and is the first of its input registered to the buffer
 	///			(e.g HoldTime == 1)
-	bool CanInvokePress() const;
+	bool CanInvokePress() const { return HoldTime == 1 && !bUsed; }
 
 	/// @brief  Returns true if the initial press was used, but this input has now been released (HoldTime < 0)
-	bool CanInvokeRelease() const;
+	bool CanInvokeRelease() const { return HoldTime < 0; }
 
 	/// @brief  Returns true if the initial press was used, and this input has continued to be held (HoldTime > 1)
-	bool CanInvokeHold() const;
-
+	bool CanInvokeHold() const { return HoldTime > 1; }
 };
 
-/* Row of an input buffer. Holds a collection of input frame states and defines the primitive of the actual buffer */
-USTRUCT()
-struct COREFRAMEWORK_API FBufferFrame
+/// @brief	Rows of the input buffer, frame (0) being the newest. Holds the state of every buffered input on every frame in flat
+///			(NumFrames x NumSlots) arrays, one per field, owned by the ring. Frames are rows of consecutive slots (assigned by
+///			UInputBufferSubsystem when the buffer is initialized), so no tag lookups happen per frame and a whole field of the buffer
+///			is a single block of memory. The ring is always full, advancing it recycles the oldest row as the new front in place.
+class COREFRAMEWORK_API FBufferFrameRing
 {
-	GENERATED_BODY()
+public:
+	/// @brief Sizes the ring for (InNumFrames) frames of (InNumSlots) inputs each, every input starts out with no input registered
+	void Initialize(int32 InNumFrames, int32 InNumSlots);
+
+	/// @brief Recycles the oldest frame as the new front, carrying over the previous front's state and resolving the raw input on top of it
+	/// @param RawValueContainer Raw input values indexed by action slot
+	void Advance(const TArray<FRawInputValue>& RawValueContainer);
+
+	/// @brief Assembles the state of a single input on a frame, mostly for debug displays
+	FInputFrameState GetFrameState(int32 Frame, int32 Slot) const;
+
+	/// @brief Copies every field of the ring out into contiguous storage of (NumFrames * NumSlots) elements each, in storage order
+	/// @param OutFrontRow Row of the newest frame in the copied storage
+	void WriteRows(FInputActionValue* OutValues, int32* OutHoldTimes, bool* OutUsedFlags, bool* OutReleaseFlags, int32& OutFrontRow) const;
+
+	/// @brief Overwrites every field of the ring from contiguous storage written by WriteRows, the ring must already be sized
+	void ReadRows(const FInputActionValue* InValues, const int32* InHoldTimes, const bool* InUsedFlags, const bool* InReleaseFlags, int32 InFrontRow);
 
 public:
-	FBufferFrame() {};
+	FORCEINLINE int32 NumFrames() const { return FrameCount; }
+	FORCEINLINE int32 NumSlots() const { return SlotCount; }
+
+	FORCEINLINE const FInputActionValue& GetValue(int32 Frame, int32 Slot) const { return Values[Cell(Frame, Slot)]; }
 	
-	/// @brief Initializes a row of the input buffer
-	void InitializeFrame(const FGameplayTagContainer& CachedActionIDs);
+	FORCEINLINE int32 GetHoldTime(int32 Frame, int32 Slot) const { return HoldTimes[Cell(Frame, Slot)]; }
+	
+	FORCEINLINE bool IsUsed(int32 Frame, int32 Slot) const { return UsedFlags[Cell(Frame, Slot)]; }
+	FORCEINLINE void SetUsed(int32 Frame, int32 Slot, bool bInUsed) { UsedFlags[Cell(Frame, Slot)] = bInUsed; }
+	
+	FORCEINLINE bool IsReleaseFlagged(int32 Frame, int32 Slot) const { return ReleaseFlags[Cell(Frame, Slot)]; }
+	FORCEINLINE void SetReleaseFlagged(int32 Frame, int32 Slot, bool bInFlagged) { ReleaseFlags[Cell(Frame, Slot)] = bInFlagged; }
+
+	/// @brief  Returns true if the input has not been used and this is the first frame its registered in the buffer (e.g HoldTime == 1)
+	FORCEINLINE bool CanInvokePress(int32 Frame, int32 Slot) const { const int32 Index = Cell(Frame, Slot); return HoldTimes[Index] == 1 && !UsedFlags[Index]; }
 
-	/// @brief Update the state of all inputs in the current frame, resolving any open commands 
-	void UpdateFrameState(const TMap<FGameplayTag, FRawInputValue>& RawValueContainer);
+	/// @brief  Returns true if the input has now been released (HoldTime < 0)
+	FORCEINLINE bool CanInvokeRelease(int32 Frame, int32 Slot) const { return HoldTimes[Cell(Frame, Slot)] < 0; }
 
-	/// @brief Copies over the frame state into here
-	/// @param CachedActionIDs
-	/// @param FrameState Frame state to copy
-	void CopyFrameState(const FGameplayTagContainer& CachedActionIDs, FBufferFrame& FrameState);
+	/// @brief  Returns true if the input has continued to be held (HoldTime > 1)
+	FORCEINLINE bool CanInvokeHold(int32 Frame, int32 Slot) const { return HoldTimes[Cell(Frame, Slot)] > 1; }
+
+protected:
+	/// @brief Index of an input on a frame in the flat arrays
+	FORCEINLINE int32 Cell(int32 Frame, int32 Slot) const
+	{
+		const int32 Row = FrontRow + Frame;
+		return (Row < FrameCount ? Row : Row - FrameCount) * SlotCount + Slot;
+	}
+
+	/// @brief Checks the assigned input and resolves its state (Held, Released, Axis, etc...)
+	void ResolveCommand(int32 Index, const FRawInputValue& RawValue);
 	
-public:
-	/// @brief State of each input on a given frame
-	TMap<FGameplayTag, FInputFrameState> InputsFrameState;
+protected:
+	/// @brief Raw input action value from EIC of each input on each frame
+	TArray<FInputActionValue> Values;
+
+	/// @brief	Input state value of each input on each frame. (0) if no input, (<0) if the input was released the last frame, and time in
+	///			which input has been held otherwise.
+	TArray<int32> HoldTimes;
+
+	/// @brief	True if the input has been consumed already and invalid for further use.
+	TArray<bool> UsedFlags;
+
+	/// @brief  Used to keep track of a release event being invoked so it doesnt linger in the buffer
+	TArray<bool> ReleaseFlags;
+
+	/// @brief	Row holding frame (0)
+	int32 FrontRow = 0;
+	int32 FrameCount = 0;
+	int32 SlotCount = 0;
 };
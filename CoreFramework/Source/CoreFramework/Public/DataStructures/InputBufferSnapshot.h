@@ -0,0 +1,81 @@
+﻿// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputBufferPrimitives.h"
+#include <type_traits>
+
+// Snapshots are plain byte copies of the buffer state, anything they hold has to survive being memcpy'd
+static_assert(std::is_trivially_copyable_v<FInputActionValue>, "Input buffer snapshots memcpy FInputActionValue");
+static_assert(std::is_trivially_copyable_v<FBufferStateTuple>, "Input buffer snapshots memcpy FBufferStateTuple");
+static_assert(std::is_trivially_copyable_v<FButtonFrameTracker>, "Input buffer snapshots memcpy FButtonFrameTracker");
+static_assert(std::is_trivially_copyable_v<FRawInputValue>, "Input buffer snapshots memcpy FRawInputValue");
+
+/// @brief	Byte offset of each section of an input buffer snapshot. Every section is a contiguous array, the buffer frames' fields are
+///			copied in the ring's storage order (see FBufferFrameRing) so a whole section is written with a single copy.
+///			Fixed once the buffer is initialized, every snapshot of the buffer has the same size.
+struct COREFRAMEWORK_API FInputBufferSnapshotLayout
+{
+	int32 NumFrames = 0;
+	int32 NumSlots = 0;
+	int32 NumDirectionals = 0;
+
+	SIZE_T Values = 0;
+	SIZE_T HoldTimes = 0;
+	SIZE_T UsedFlags = 0;
+	SIZE_T ReleaseFlags = 0;
+	SIZE_T ValidFrames = 0;
+	SIZE_T LastEvaluatedValidFrames = 0;
+	SIZE_T FrameTrackers = 0;
+	SIZE_T RawValues = 0;
+	SIZE_T DirectionalValidFrames = 0;
+	SIZE_T DirectionalUnconsumedFrames = 0;
+	SIZE_T LastEvaluatedDirectionalValidFrames = 0;
+	SIZE_T Scalars = 0;
+	SIZE_T Size = 0;
+
+	void Compute(const int32 InNumFrames, const int32 InNumSlots, const int32 InNumDirectionals);
+};
+
+/// @brief	Scalar state of the input buffer stored at the end of a snapshot
+struct FInputBufferSnapshotScalars
+{
+	double ElapsedTime = 0.0;
+	double BufferClock = 0.0;
+	int32 FrontRow = 0;
+	bool bEvaluateAllBindings = false;
+};
+
+/// @brief	Ring of fixed size input buffer snapshots, each tagged with the simulation frame it was saved on. Storage is allocated once,
+///			saving a snapshot overwrites the oldest one.
+class COREFRAMEWORK_API FInputBufferSnapshotRing
+{
+public:
+	/// @brief	Allocates (NumSnapshots) snapshots of the given layout, discarding any saved snapshot
+	void Initialize(const FInputBufferSnapshotLayout& InLayout, const int32 NumSnapshots);
+
+	/// @brief	Returns the storage to save a snapshot of the given frame in (overwriting the oldest snapshot), null if not initialized
+	uint8* Allocate(const int32 Frame);
+
+	/// @brief	Returns the snapshot saved on the given frame, null if it's not (or no longer) in the ring
+	const uint8* Find(const int32 Frame) const;
+
+	/// @brief	Discards every saved snapshot
+	void Invalidate();
+
+	const FInputBufferSnapshotLayout& GetLayout() const { return Layout; }
+	int32 Num() const { return SnapshotFrames.Num(); }
+	bool IsInitialized() const { return !SnapshotFrames.IsEmpty(); }
+
+protected:
+	FInputBufferSnapshotLayout Layout;
+	
+	/* Snapshot (i) lives at [i * Layout.Size] */
+	TArray<uint8, TAlignedHeapAllocator<16>> Storage;
+	
+	/* Frame each snapshot was saved on, INDEX_NONE if unused */
+	TArray<int32> SnapshotFrames;
+	
+	int32 NextSnapshot = 0;
+};
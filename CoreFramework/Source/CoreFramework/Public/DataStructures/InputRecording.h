@@ -0,0 +1,116 @@
+﻿// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+struct FRawInputValue;
+
+/// @brief	Header of a binary input recording. The file is laid out as [Header][Slot Names][Ticks][Inputs], each section is
+///			made of fixed size records aligned to 8 bytes so a mapped recording can be read in place (little-endian).
+///			- Slot Names: Null terminated UTF-8 action IDs in the order of the recorded slot table
+///			- Ticks: Number of buffer updates each recorded tick ran, events were evaluated once after each tick
+///			- Inputs: Raw input values in the order they were registered, each tagged with the buffer update that registered it
+struct FInputRecordingHeader
+{
+	static constexpr uint32 MAGIC = 0x43524249; // "IBRC"
+	static constexpr uint32 VERSION = 1;
+	
+	uint32 Magic = MAGIC;
+	uint32 Version = VERSION;
+	float TickInterval = 0.f;
+	uint32 NumSlots = 0;
+	uint32 SlotNamesSize = 0;
+	uint32 NumTicks = 0;
+	uint32 NumInputs = 0;
+	uint32 NumUpdates = 0;
+
+	int64 GetTicksOffset() const { return sizeof(FInputRecordingHeader) + SlotNamesSize; }
+	int64 GetInputsOffset() const { return Align(GetTicksOffset() + NumTicks * sizeof(uint32), 8); }
+	int64 GetFileSize() const;
+};
+static_assert(sizeof(FInputRecordingHeader) == 32, "Input recording header layout changed, bump FInputRecordingHeader::VERSION");
+
+/// @brief	Raw input value registered in a recorded slot before the buffer update (Update) ran
+struct FRecordedRawInput
+{
+	uint32 Update = 0;
+	uint16 Slot = 0;
+	uint8 ValueType = 0;
+	uint8 Padding = 0;
+	float Value[3] = { 0.f, 0.f, 0.f };
+	float TriggeredTime = 0.f;
+	double Timestamp = 0.0;
+
+	FRawInputValue ToRawValue() const;
+};
+static_assert(sizeof(FRecordedRawInput) == 32, "Recorded raw input layout changed, bump FInputRecordingHeader::VERSION");
+
+/// @brief	Records the raw input registered in the input buffer along with how many buffer updates each tick ran, so the
+///			buffer (and the events evaluated from it) can be reproduced by feeding the same input on the same updates
+class COREFRAMEWORK_API FInputRecordingWriter
+{
+public:
+	/// @brief	Starts a new recording keyed by the given slot table
+	void Begin(const TArray<FGameplayTag>& SlotActionIDs, const float InTickInterval);
+
+	/// @brief	Records a raw input registered for the next buffer update
+	void RecordInput(const int32 Slot, const FRawInputValue& RawValue, const double Timestamp);
+
+	/// @brief	Records a buffer update, called before the update reads the registered input
+	void RecordUpdate() { NumUpdates++; NumTickUpdates++; }
+
+	/// @brief	Records the end of a tick, events are evaluated once per recorded tick on replay
+	void RecordTick() { Ticks.Add(NumTickUpdates); NumTickUpdates = 0; }
+
+	/// @brief	Stops recording and writes the recording to the given file
+	bool End(const FString& FilePath);
+
+	bool IsRecording() const { return bRecording; }
+
+protected:
+	TArray<FGameplayTag> SlotNames;
+	TArray<uint32> Ticks;
+	TArray<FRecordedRawInput> Inputs;
+	uint32 NumUpdates = 0;
+	uint32 NumTickUpdates = 0;
+	float TickInterval = 0.f;
+	bool bRecording = false;
+};
+
+/// @brief	Read-only view over an input recording, mapped from disk when the platform supports it and loaded otherwise
+class COREFRAMEWORK_API FInputRecordingReader
+{
+public:
+	FInputRecordingReader();
+	~FInputRecordingReader();
+
+	/// @brief	Opens & validates a recording
+	/// @return	False if the file couldn't be read or isn't a valid recording
+	bool Open(const FString& FilePath);
+
+	const FInputRecordingHeader& GetHeader() const { return *reinterpret_cast<const FInputRecordingHeader*>(Data); }
+
+	/// @brief	Action IDs of the recorded slot table, in slot order
+	const TArray<FName>& GetSlotNames() const { return SlotNames; }
+
+	TArrayView<const uint32> GetTicks() const
+	{
+		return TArrayView<const uint32>(reinterpret_cast<const uint32*>(Data + GetHeader().GetTicksOffset()), GetHeader().NumTicks);
+	}
+	
+	TArrayView<const FRecordedRawInput> GetInputs() const
+	{
+		return TArrayView<const FRecordedRawInput>(reinterpret_cast<const FRecordedRawInput*>(Data + GetHeader().GetInputsOffset()), GetHeader().NumInputs);
+	}
+
+protected:
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	TArray<uint8> LoadedData;
+	TArray<FName> SlotNames;
+	const uint8* Data;
+};
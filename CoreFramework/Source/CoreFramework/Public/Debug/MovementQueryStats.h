@@ -0,0 +1,73 @@
+// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/* Scene query instrumentation of the movement component, compiled out of shipping builds */
+#ifndef RMC_QUERY_STATS
+	#define RMC_QUERY_STATS !UE_BUILD_SHIPPING
+#endif
+
+/* Forward Declarations */
+class URadicalMovementComponent;
+
+/* Code path a scene query issued by the movement component is attributed to. The innermost site wins, e.g floor checks issued while stepping up count as Floor */
+enum class EMovementQuerySite : uint8
+{
+	Move,				// Moves issued outside of any other site (MoveAlongFloor, falling, rotation...)
+	Floor,				// FindFloor, including its async probes
+	Perch,				// ComputePerchResult
+	StepUp,
+	SlideAlongSurface,
+	LedgeCheck,			// CheckLedgeDirection
+	Crouch,				// Encroachment tests when changing capsule size
+	Repulsion,			// Overlaps evaluated by ApplyRepulsionForce
+	Num
+};
+
+enum class EMovementQueryType : uint8
+{
+	Sweep,
+	LineTrace,
+	Overlap,
+	Num
+};
+
+/* Scene queries issued by a movement component, by site and type */
+struct COREFRAMEWORK_API FMovementQueryCounts
+{
+	static constexpr int32 NumSites = static_cast<int32>(EMovementQuerySite::Num);
+	static constexpr int32 NumTypes = static_cast<int32>(EMovementQueryType::Num);
+
+	uint32 Counts[NumSites][NumTypes];
+
+	FMovementQueryCounts() { Reset(); }
+
+	FORCEINLINE void Reset() { FMemory::Memzero(Counts); }
+
+	FORCEINLINE void Add(EMovementQuerySite Site, EMovementQueryType Type, uint32 Count = 1)
+	{
+		Counts[static_cast<int32>(Site)][static_cast<int32>(Type)] += Count;
+	}
+
+	FORCEINLINE uint32 Get(EMovementQuerySite Site, EMovementQueryType Type) const
+	{
+		return Counts[static_cast<int32>(Site)][static_cast<int32>(Type)];
+	}
+
+	uint32 GetSiteTotal(EMovementQuerySite Site) const;
+	uint32 GetTypeTotal(EMovementQueryType Type) const;
+	uint32 GetTotal() const;
+
+	FMovementQueryCounts& operator+=(const FMovementQueryCounts& Other);
+
+	static const TCHAR* GetSiteName(EMovementQuerySite Site);
+	static const TCHAR* GetTypeName(EMovementQueryType Type);
+};
+
+namespace MovementQueryStats
+{
+	/// @brief  Reports the queries a component issued during its last update to the stats system, and the RMCQueries trace channel (-trace=RMCQueries)
+	void ReportUpdate(const URadicalMovementComponent& Component, const FMovementQueryCounts& Counts);
+}
@@ -43,4 +43,10 @@ public:
 		
 		return GetInputBufferSettings_Internal()->GetBufferTickInterval();
 	}
+	static bool GetInputBufferTimestampedSampling()
+	{
+		if (GetInputBufferSettings_Internal() == nullptr) return false;
+		
+		return GetInputBufferSettings_Internal()->IsTimestampedSampling();
+	}
 };
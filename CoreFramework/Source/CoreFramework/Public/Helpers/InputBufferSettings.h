@@ -26,6 +26,10 @@ protected:
 	/// @brief  Framerate in which the input buffer is updated
 	UPROPERTY(Category=InputBuffer, Config, EditDefaultsOnly, meta=(UIMin=0, ClampMin=0, UIMax=120, ClampMax=120))
 	float UpdateFrameRate			= 60;
+	/// @brief  Timestamps input events with the platform clock and registers them in the buffer frame they occurred in. The buffer is
+	///			then advanced by every whole interval elapsed in real time, instead of by game time with input registered on the next update
+	UPROPERTY(Category=InputBuffer, Config, EditDefaultsOnly)
+	bool bTimestampedSampling		= false;
 
 public:
 
@@ -35,6 +39,8 @@ public:
 	uint8 GetBufferButtonFrameWindow() const { return ButtonFrameWindow; }
 	UFUNCTION(Category=InputBufferSettings, BlueprintPure)
 	float GetBufferTickInterval() const { return 1/UpdateFrameRate; }
+	UFUNCTION(Category=InputBufferSettings, BlueprintPure)
+	bool IsTimestampedSampling() const { return bTimestampedSampling; }
 	
 protected:
 	
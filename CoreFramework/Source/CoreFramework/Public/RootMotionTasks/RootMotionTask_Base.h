@@ -9,6 +9,29 @@
 class ARadicalCharacter;
 class URadicalMovementComponent;
 enum class ERootMotionFinishVelocityMode : uint8;
+class URootMotionTask_Base;
+
+/**
+ *	Generation checked reference to a root motion task. Finished tasks are recycled by their character for the next dash or jump, a handle
+ *	taken before that stops resolving so code holding on to a finished task can't cancel or read the unrelated task reusing its object.
+ */
+struct COREFRAMEWORK_API FRootMotionTaskHandle
+{
+	FRootMotionTaskHandle() = default;
+	FRootMotionTaskHandle(URootMotionTask_Base* InTask, uint32 InGeneration) : Task(InTask), Generation(InGeneration) {}
+
+	/// @brief  The task this handle was taken from, nullptr once it finished and went back to the pool
+	URootMotionTask_Base* Get() const;
+
+	FORCEINLINE bool IsValid() const { return Get() != nullptr; }
+
+	FORCEINLINE bool operator==(const FRootMotionTaskHandle& Other) const { return Task == Other.Task && Generation == Other.Generation; }
+	FORCEINLINE bool operator!=(const FRootMotionTaskHandle& Other) const { return !(*this == Other); }
+
+private:
+	TWeakObjectPtr<URootMotionTask_Base> Task;
+	uint32 Generation = 0;
+};
 
 /** Base class for specialized root motion attributes */
 UCLASS()
@@ -27,7 +50,8 @@ class COREFRAMEWORK_API URootMotionTask_Base : public UObject, public FTickableG
 
 	// BEGIN FTickableGameObject Interface
 	virtual void Tick( float DeltaTime ) override;
-	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Always; }
+	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	virtual bool IsTickable() const override { return !bPooled; }
 	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT( UInputBufferSubsystem, STATGROUP_Tickables ); }
 	virtual bool IsTickableWhenPaused() const { return true; }
 	virtual bool IsTickableInEditor() const { return false; }
@@ -49,10 +73,16 @@ public:
 
 	virtual void ExternalCancel() {};
 
-	virtual void OnDestroy()
-	{
-		MarkAsGarbage();
-	};
+	/// @brief  Hands the task back to its character's pool to be recycled by ARadicalCharacter::NewRootMotionTask, or marks it as garbage if it has no character
+	virtual void OnDestroy();
+
+	FORCEINLINE bool IsPooled() const { return bPooled; }
+
+	/// @brief  Handle to this use of the task, hold on to it instead of the task to find out whether it's still running (@see FRootMotionTaskHandle)
+	FORCEINLINE FRootMotionTaskHandle GetHandle() const { return FRootMotionTaskHandle(const_cast<URootMotionTask_Base*>(this), Generation); }
+
+	/// @brief  Number of times the task went back to the pool, handles taken before the last release no longer resolve
+	FORCEINLINE uint32 GetGeneration() const { return Generation; }
 
 protected:
 
@@ -60,6 +90,9 @@ protected:
 
 	virtual bool HasTimedOut() const;
 
+	/// @brief  Clears the state of a finished task before it's pooled. Overrides should unbind their delegates so a recycled task doesn't notify the previous listeners
+	virtual void ResetTask();
+
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override {}
 	
 	UPROPERTY()
@@ -92,4 +125,10 @@ protected:
 
 	uint32 LastFrameNumberWeTicked = INDEX_NONE;
 
+	/* Released to the character's pool, waiting to be recycled */
+	bool bPooled = false;
+
+	/* Bumped every time the task is released to the pool, invalidating the handles to its previous use */
+	uint32 Generation = 0;
+
 };
@@ -18,6 +18,8 @@ class COREFRAMEWORK_API URootMotionTask_ConstantForce : public URootMotionTask_B
 {
 	GENERATED_BODY()
 
+	friend class FRootMotionTaskPoolTest;
+
 	UPROPERTY(BlueprintAssignable)
 	FApplyRootMotionConstantForceDelegate OnFinish;
 
@@ -47,6 +49,7 @@ class COREFRAMEWORK_API URootMotionTask_ConstantForce : public URootMotionTask_B
 protected:
 
 	virtual void SharedInitAndApply() override;
+	virtual void ResetTask() override;
 	
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override {}
 
@@ -50,6 +50,7 @@ class COREFRAMEWORK_API URootMotionTask_JumpForce : public URootMotionTask_Base
 protected:
 
 	virtual void SharedInitAndApply() override;
+	virtual void ResetTask() override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override {}
 
 	/**
@@ -50,6 +50,7 @@ class COREFRAMEWORK_API URootMotionTask_MoveToActorForce : public URootMotionTas
 protected:
 
 	virtual void SharedInitAndApply() override;
+	virtual void ResetTask() override;
 
 	bool UpdateTargetLocation(float DeltaTime);
 
@@ -39,6 +39,7 @@ class COREFRAMEWORK_API URootMotionTask_MoveToForce : public URootMotionTask_Bas
 protected:
 
 	virtual void SharedInitAndApply() override;
+	virtual void ResetTask() override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override {}
 
 protected:
@@ -4,9 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/LocalPlayerSubsystem.h"
-#include "BufferContainer.h"
+#include "InputBindingRegistry.h"
 #include "InputData.h"
 #include "InputBufferPrimitives.h"
+#include "InputRecording.h"
+#include "InputBufferSnapshot.h"
 #include "InputBufferSubsystem.generated.h"
 
 /* Profiling & Log Groups */
@@ -25,7 +27,7 @@ class COREFRAMEWORK_API UInputBufferSubsystem : public ULocalPlayerSubsystem, pu
 	GENERATED_BODY()
 
 	friend class ABufferedController;
-	friend struct FBufferFrame;
+	friend struct FInputBufferBenchmark;
 	friend struct FInputFrameState;
 	
  // BEGIN USubsystem Interface
@@ -70,49 +72,133 @@ public:
 	UFUNCTION(Category="InputBuffer", BlueprintPure, meta=(GameplayTagFilter="Input"))
 	const UBufferedInputAction* GetInputAction(const FGameplayTag& InputTag) const
 	{
-		auto AllActions = InputMap->GetInputActions();
-		for (const auto& action : AllActions)
-		{
-			if (action->InputTag.MatchesTag(InputTag)) return action;
-		}
-		return nullptr;
+		return InputMap ? InputMap->FindInputAction(InputTag) : nullptr;
 	}
 
 	
 	void DisableInput() { bInputDisabled = true; }
-	void EnableInput() { bInputDisabled = false; }
+	void EnableInput() { bInputDisabled = false; bEvaluateAllBindings = true; }
+
+	const FBufferFrameRing& GetInputBufferData() const { return InputBuffer; }
+
+	/// @brief	Action IDs in the order of their slots in the buffer frames (e.g GetInputBufferData().GetHoldTime(Frame, Slot))
+	const TArray<FGameplayTag>& GetBufferedActionIDs() const { return SlotActionIDs; }
+
+	/// @brief	True if the input in the given slot has been consumed on the given buffer frame. Frames in the tracked window are read off
+	///			the slot's tracker, older ones off the buffer frames (consuming sets both)
+	bool IsFrameConsumed(const int32 Frame, const int32 Slot) const
+	{
+		return IsWindowTracked() && Frame < 64 ? ButtonFrameTrackers[Slot].IsUsed(Frame) : InputBuffer.IsUsed(Frame, Slot);
+	}
+
+	/// @brief	Returns the slot of the given action in the buffer frames, INDEX_NONE if the action is not buffered
+	FORCEINLINE int32 GetActionSlot(const FGameplayTag& InputID) const
+	{
+		const int32* Slot = ActionSlots.Find(InputID);
+		return Slot ? *Slot : INDEX_NONE;
+	}
+
+	/// @brief	Returns the slot of the given directional action in DirectionalInputValidFrame, INDEX_NONE if it's not buffered
+	FORCEINLINE int32 GetDirectionalSlot(const FGameplayTag& InputID) const
+	{
+		const int32* Slot = DirectionalSlots.Find(InputID);
+		return Slot ? *Slot : INDEX_NONE;
+	}
+
+	/* ~~~~~ Snapshots ~~~~~ */
+	/// @brief	Allocates a ring of (NumSnapshots) fixed size snapshots of the buffer state, discarding any saved snapshot.
+	///			Snapshots are re-allocated (and discarded) whenever the buffer is re-initialized.
+	void InitializeSnapshots(const int32 NumSnapshots);
+
+	/// @brief	Saves the buffer state (frames, valid frames, raw input & evaluation state) of the given simulation frame, overwriting the
+	///			oldest snapshot in the ring
+	/// @return	False if snapshots weren't initialized
+	bool SaveSnapshot(const int32 Frame);
 
-	const TBufferContainer<FBufferFrame>& GetInputBufferData() const { return InputBuffer; }
+	/// @brief	Restores the buffer state saved on the given simulation frame. Bindings aren't part of the state, they're evaluated
+	///			against the restored state as if the frames after the snapshot never happened.
+	/// @return	False if there's no snapshot of the frame in the ring
+	bool RestoreSnapshot(const int32 Frame);
+
+	/// @brief	Size in bytes of a single snapshot
+	int32 GetSnapshotSize() const { return SnapshotRing.GetLayout().Size; }
+
+	/* ~~~~~ Recording & Replay ~~~~~ */
+	/// @brief	Starts recording the raw input registered in the buffer, keyed by the current slot table
+	/// @return	False if the buffer isn't initialized or is already recording
+	bool StartInputRecording();
+
+	/// @brief	Stops recording and writes the recording to the given file (see FInputRecordingHeader for the layout)
+	bool StopInputRecording(const FString& FilePath);
+
+	bool IsRecordingInput() const { return InputRecorder.IsRecording(); }
+
+	/// @brief	Resets the buffer and replays a recording through it as fast as possible, updating the buffer and evaluating bound events
+	///			the same way they were when recorded. Doesn't require a player controller, input is fed straight into the buffer.
+	/// @param	FilePath Recording to replay
+	/// @param	ReplayInputMap Input map to initialize the buffer with, if null the current input map is used
+	/// @return	Number of buffer updates replayed, INDEX_NONE if the recording couldn't be replayed
+	int32 ReplayInputRecording(const FString& FilePath, UInputBufferMap* ReplayInputMap = nullptr);
 
 protected:
-	/// @brief  True if the specified input has already been consumed
-	bool IsInputConsumed(const FGameplayTag& InputID, bool bCheckNewer = false);
+	/// @brief  True if the input in the specified slot has already been consumed
+	bool IsInputConsumed(const int32 Slot, bool bCheckNewer = false);
 	
-	/// @brief  If an input is consumed, propagate the consume state up the buffer to most recent register of said input
-	void PropagateConsume(const FGameplayTag& InputID, const uint8 FromFrame);
+	/// @brief  Consumes an input from the given frame, propagating the consume state up the buffer to most recent register of said input
+	void PropagateConsume(const int32 Slot, const uint8 FromFrame);
+
+	/// @brief  True if the button window fits in FButtonFrameTracker's masks, the trackers then hold each input's press, event & consumed
+	///			state across the window and only the front frame's flags are kept up to date (they're carried into the next frame)
+	FORCEINLINE bool IsWindowTracked() const { return BUTTON_BUFFER_SIZE <= 64; }
+
+	/// @brief  True if the input can invoke a press on the given frame (first frame it's registered & not consumed)
+	FORCEINLINE bool CanInvokePress(const int32 Frame, const int32 Slot) const
+	{
+		return InputBuffer.GetHoldTime(Frame, Slot) == 1 && !IsFrameConsumed(Frame, Slot);
+	}
 
 	/// @brief  Updates the buffer with input received from EIC [Fixed Tick Interval]
 	void UpdateBuffer();
 
+	/// @brief  Rescans the button window of an input from oldest to newest to find the frames in which it can be used
+	void EvaluateButtonValidFrame(const int32 Slot, FBufferStateTuple& OutValidFrame);
+
+	/// @brief  Resolves the frames in which an input can be used from its incrementally tracked window (see FButtonFrameTracker)
+	void ResolveButtonValidFrame(const int32 Slot, FBufferStateTuple& OutValidFrame);
+
 	/// @brief  Checks the buffers current state and broadcasts the appropriate input events [Tick constantly]
 	void EvaluateEvents();
 
+	/// @brief  Collects the inputs whose valid frame changed since the last evaluation into DirtyInputTags
+	void GatherDirtyInputs();
+
 protected:
 	/* ~~~~~ Input Registration & Initialization ~~~~~ */
+	/// @brief  Resets the buffer state & reads the buffer settings from the project settings
+	void InitializeBufferSettings();
+
 	/// @brief  Adds the input map to the EIC subsystem & binds EIC events to buffer data
 	void InitializeInputMapping(UEnhancedInputComponent* InputComponent);
 
-	/// @brief Initializes buffer structures, called after InputMapping was initialized and IDs generated
+	/// @brief Initializes buffer structures and assigns each action its slot, called after IDs were generated
 	void InitializeInputBufferData();
 
 	/// @brief Event triggered for an input once its been and continues to be triggered
-	void TriggerInput(const FInputActionInstance& ActionInstance, const FGameplayTag InputID);
+	void TriggerInput(const FInputActionInstance& ActionInstance, const int32 Slot);
 
 	/// @brief Event triggered for an input once its no longer considered held
-	void CompleteInput(const FInputActionInstance& ActionInstance, const FGameplayTag InputID);
+	void CompleteInput(const FInputActionInstance& ActionInstance, const int32 Slot);
+
+	/// @brief Stores an input's raw value for the next buffer update, or queues it with its timestamp when sampling is timestamped
+	void RegisterRawInput(const FRawInputValue& RawValue, const int32 Slot);
+
+	/// @brief Moves the queued raw inputs received before the end of the buffer frame being updated into RawValueContainer
+	void RegisterPendingRawInputs(const double FrameEndTime);
 	/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-	void ProcessDirectionVector(const FVector2D& DirectionInputVector, FVector& ProcessedInputVector, FVector& OutPlayerForward, FVector& OutPlayerRight) const;
+	/// @brief  Computes the basis directional input is processed in (relative input rotation & player facing) for this buffer update
+	/// @return False if there's no pawn to evaluate directional input relative to
+	bool ComputeDirectionalBasis(FVector& OutInputForward, FVector& OutInputRight, FVector& OutPlayerForward, FVector& OutPlayerRight) const;
 
 public:
 	void DisplayDebug(UCanvas* Canvas, const FDebugDisplayInfo& DebugDisplay, float& YL, float& YPos);
@@ -126,6 +212,7 @@ protected:
 	uint8 BUTTON_BUFFER_SIZE;
 	uint8 BUFFER_SIZE;
 	float TICK_INTERVAL;
+	uint64 BUTTON_WINDOW_MASK;
 	uint32 LastFrameNumberWeTicked = INDEX_NONE;
 	
 	/* ~~~~~ Initialization & Update Tracking ~~~~~ */
@@ -138,36 +225,98 @@ protected:
 	UPROPERTY(Transient)
 	double ElapsedTime;
 
+	/// @brief	Whether input is sampled against the platform clock (see UInputBufferSettings::bTimestampedSampling)
+	bool bTimestampedSampling;
+	
+	/// @brief	Platform time at which the newest buffer frame ended when sampling is timestamped
+	double BufferClock;
+
 	FGameplayTagContainer CachedActionIDs;
 	FGameplayTagContainer CachedDirectionalActionIDs;
-	TMap<FGameplayTag, FRawInputValue> RawValueContainer;
+
+	/// @brief	Dense slot assigned to each action when the buffer is initialized, every per-action buffer structure is indexed by it
+	TMap<FGameplayTag, int32> ActionSlots;
+	/// @brief	Inverse of ActionSlots, action ID of each slot
+	TArray<FGameplayTag> SlotActionIDs;
+
+	/// @brief	Dense slot assigned to each directional action, directional tracking data is indexed by it
+	TMap<FGameplayTag, int32> DirectionalSlots;
+	/// @brief	Inverse of DirectionalSlots, directional ID of each slot
+	TArray<FGameplayTag> SlotDirectionalIDs;
+
+	/// @brief	Latest raw value registered from EIC for each action, indexed by slot
+	TArray<FRawInputValue> RawValueContainer;
+
+	/// @brief	Timestamped raw values that haven't been registered in a buffer frame yet, in the order they were received
+	TArray<FTimestampedRawInput> PendingRawInputs;
+
+	/// @brief	Records registered raw values & buffer updates while recording is active
+	FInputRecordingWriter InputRecorder;
+
+	/// @brief	Saved snapshots of the buffer state, see SaveSnapshot
+	FInputBufferSnapshotRing SnapshotRing;
 
 	/* ~~~~~ Managed Data ~~~~~ */
 	/// @brief	The rows of the input buffer, each containing a column corresponding to each input type
-	///			each row is an input buffer frame (FBufferFrame), corresponding to the state of each input
+	///			each row is an input buffer frame, corresponding to the state of each input
 	///			at the buffer frame (i)
-	TBufferContainer<FBufferFrame> InputBuffer;
+	FBufferFrameRing InputBuffer;
 	
 	/// @brief	Holds the two oldest frames of each input in which it can be used. (-1) corresponds to no input that can used,
 	///			meaning its not been registered, or been held for a while such that its no longer valid. Oldest frame to more
-	///			easily check chorded actions/input sequence (We hold 2 to account for a button sequence of the same input type)
+	///			easily check chorded actions/input sequence (We hold 2 to account for a button sequence of the same input type).
+	///			Indexed by action slot.
 	UPROPERTY(Transient)
-	TMap<FGameplayTag, FBufferStateTuple> ButtonInputValidFrame;
+	TArray<FBufferStateTuple> ButtonInputValidFrame;
+
+	/// @brief	Press & event masks of each input across the button window, shifted every buffer update so ButtonInputValidFrame
+	///			can be resolved without rescanning the window. Indexed by action slot.
+	TArray<FButtonFrameTracker> ButtonFrameTrackers;
 
 	/// @brief	Holds the oldest frame of which a directional input was registered valid. (-1) corresponds to no input that can be used,
 	///			meaning its not been registered (DI have no concept of "held"). Frame held is the oldest frame in the buffer in which the input
-	///			was valid.
+	///			was valid. Indexed by directional slot.
 	UPROPERTY(Transient)
-	TMap<FGameplayTag, int8> DirectionalInputValidFrame;
+	TArray<int8> DirectionalInputValidFrame;
+
+	/// @brief	Number of newest buffer frames each directional can still be matched in. Consuming a directional shrinks it to the frames
+	///			newer than the consumed match, and it grows back by a frame every buffer update, so a consumed motion has to be performed
+	///			again instead of firing while it's still in the window (the directional counterpart of the buttons' used flags).
+	///			Indexed by directional slot.
+	TArray<uint8> DirectionalUnconsumedFrames;
+
+	/// @brief	Motion actions of the directional map compiled when the buffer is initialized, stepped together in one pass over the buffer
+	TArray<FMotionCommandAutomaton> MotionAutomata;
+	bool bAnyRelativeMotionAction;
+
+	/// @brief	Directional axis of each buffer frame, and its command direction (raw & relative to the player). Filled once per buffer
+	///			update and shared by every motion action
+	TArray<FVector2D> FrameAxisInputs;
+	TArray<uint8> FrameDirections;
+	TArray<uint8> FrameRelativeDirections;
 
 #pragma region EVENTS
 
 protected:
 
-	TMap<FButtonBinding, FInputActionDelegateHandle> ActionDelegates;
-	TMap<FButtonSequenceBinding, FInputActionSequenceDelegateHandle> ActionSeqDelegates;
-	TMap<FDirectionalBinding, FDirectionalActionDelegateHandle> DirectionalDelegates;
-	TMap<FDirectionalSequenceBinding, FDirectionalAndActionDelegateHandle> DirectionAndActionDelegates;
+	TInputBindingRegistry<FButtonBinding, FInputActionDelegateHandle> ActionDelegates;
+	TInputBindingRegistry<FButtonSequenceBinding, FInputActionSequenceDelegateHandle> ActionSeqDelegates;
+	TInputBindingRegistry<FDirectionalBinding, FDirectionalActionDelegateHandle> DirectionalDelegates;
+	TInputBindingRegistry<FDirectionalSequenceBinding, FDirectionalAndActionDelegateHandle> DirectionAndActionDelegates;
+
+	/// @brief	Valid frames as of the last evaluation, bindings are only evaluated once the state of an input they depend on changes.
+	///			Continuous bindings (holds, and bindings that don't consume their input) are evaluated on every evaluation regardless
+	TArray<FBufferStateTuple> LastEvaluatedButtonValidFrame;
+	TArray<int8> LastEvaluatedDirectionalValidFrame;
+	
+	/// @brief	Inputs whose valid frame changed since the last evaluation
+	TArray<FGameplayTag> DirtyInputTags;
+	
+	/// @brief	Scratch list of the bindings gathered for evaluation
+	TArray<FGatheredInputBinding> GatheredBindings;
+
+	/// @brief	Set when the evaluated state can't be trusted (e.g input was disabled), evaluates every binding next evaluation
+	bool bEvaluateAllBindings;
 	
 public:
 	
@@ -182,15 +331,9 @@ public:
 		
 		int32 NumBindings = ActionDelegates.Num();
 		
-		ActionDelegates.Add(Event, FInputActionDelegateHandle(InputTag, Trigger, bAutoConsume, Priority));
-
-		// Sort by Priority When New Action Is bound
-		const auto SortByPriority = [](const FInputActionDelegateHandle& Handle1, const FInputActionDelegateHandle& Handle2) -> bool
-		{
-			return Handle1.Priority > Handle2.Priority;
-		};
-
-		ActionDelegates.ValueSort(SortByPriority);
+		// Inserted in priority order under its input. Holds & presses that aren't consumed fire on every evaluation while their state holds
+		const bool bContinuous = Trigger == TRIGGER_Hold || (Trigger == TRIGGER_Press && !bAutoConsume);
+		ActionDelegates.Add(Event, FInputActionDelegateHandle(InputTag, Trigger, bAutoConsume, Priority), Priority, bContinuous, InputTag);
 
 		UE_LOG(LogInputBuffer, Warning, TEXT("<----- BIND ----->"))
 		if (NumBindings < ActionDelegates.Num())
@@ -220,15 +363,8 @@ public:
 			return;
 		}
 		
-		ActionSeqDelegates.Add(Event, FInputActionSequenceDelegateHandle(FirstAction, SecondAction, bAutoConsume, bFirstInputIsHold, bConsiderOrder, Priority));
-
-		// Sort by Priority When New Action Is bound
-		const auto SortByPriority = [](const FInputActionSequenceDelegateHandle& Handle1, const FInputActionSequenceDelegateHandle& Handle2) -> bool
-		{
-			return Handle1.Priority > Handle2.Priority;
-		};
-
-		ActionSeqDelegates.ValueSort(SortByPriority);
+		// Inserted in priority order under both inputs, sequences that aren't consumed fire on every evaluation while they're valid
+		ActionSeqDelegates.Add(Event, FInputActionSequenceDelegateHandle(FirstAction, SecondAction, bAutoConsume, bFirstInputIsHold, bConsiderOrder, Priority), Priority, !bAutoConsume, FirstAction, SecondAction);
 	}
 
 	void BindDirectionalAction(const FDirectionalBinding& Event, const FGameplayTag& DirectionalAction, bool bAutoConsume, int Priority = 0)
@@ -239,15 +375,8 @@ public:
 			UE_LOG(LogInputBuffer, Warning, TEXT("FAILED BindDirectionalAction: [%s] Input does not exist"), *DirectionalAction.ToString());
 			return;
 		}
-		DirectionalDelegates.Add(Event, FDirectionalActionDelegateHandle(DirectionalAction, bAutoConsume, Priority));
-
-		// Sort by Priority When New Action Is bound
-		const auto SortByPriority = [](const FDirectionalActionDelegateHandle& Handle1, const FDirectionalActionDelegateHandle& Handle2) -> bool
-		{
-			return Handle1.Priority > Handle2.Priority;
-		};
-
-		DirectionalDelegates.ValueSort(SortByPriority);
+		// Inserted in priority order under its input, directionals that aren't consumed fire on every evaluation while they're valid
+		DirectionalDelegates.Add(Event, FDirectionalActionDelegateHandle(DirectionalAction, bAutoConsume, Priority), Priority, !bAutoConsume, DirectionalAction);
 	}
 
 	void BindDirectionalActionSequence(const FDirectionalSequenceBinding& Event, const FGameplayTag& InputAction, const FGameplayTag& DirectionalAction, EDirectionalSequenceOrder SequenceOrder, bool bAutoConsume, int Priority = 0)
@@ -257,15 +386,8 @@ public:
 		{
 			return;
 		}
-		DirectionAndActionDelegates.Add(Event, FDirectionalAndActionDelegateHandle(InputAction, DirectionalAction, bAutoConsume, SequenceOrder, Priority));
-
-		// Sort by Priority When New Action Is bound
-		const auto SortByPriority = [](const FDirectionalAndActionDelegateHandle& Handle1, const FDirectionalAndActionDelegateHandle& Handle2) -> bool
-		{
-			return Handle1.Priority > Handle2.Priority;
-		};
-
-		DirectionAndActionDelegates.ValueSort(SortByPriority);
+		// Inserted in priority order under both inputs, sequences that aren't consumed fire on every evaluation while they're valid
+		DirectionAndActionDelegates.Add(Event, FDirectionalAndActionDelegateHandle(InputAction, DirectionalAction, bAutoConsume, SequenceOrder, Priority), Priority, !bAutoConsume, InputAction, DirectionalAction);
 	}
 
 	// Can't delete them directly because apparently C++ and BP don't run in sequence. Calling this in BP can happen while EvaluateEvents is running causing an ensure fail when an element is removed during the loop
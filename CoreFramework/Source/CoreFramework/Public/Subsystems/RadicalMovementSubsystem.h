@@ -0,0 +1,281 @@
+// Copyright 2023 Abdulrahmen Almodaimegh. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RadicalMovementSubsystem.generated.h"
+
+/* Forward Declarations */
+class URadicalMovementComponent;
+class URadicalMovementSubsystem;
+class UMovementData;
+enum EMovementState : int;
+
+/**
+ * Tick function that calls URadicalMovementSubsystem::TickBatch
+ **/
+USTRUCT()
+struct COREFRAMEWORK_API FRadicalMovementBatchTickFunction : public FTickFunction
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** RadicalMovementSubsystem that is the target of this tick **/
+	URadicalMovementSubsystem* Target;
+
+	virtual void ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FRadicalMovementBatchTickFunction> : public TStructOpsTypeTraitsBase2<FRadicalMovementBatchTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/* Per-character state gathered by the batch */
+struct FRadicalMovementBatchState
+{
+	FVector OldVelocity = FVector::ZeroVector;
+	FVector OldRootLocation = FVector::ZeroVector;
+	float DeltaTime = 0.f;
+	bool bMoved = false;
+	int32 VelocityRun = INDEX_NONE;		// Run the first velocity of the character is integrated in, INDEX_NONE if it isn't batched
+};
+
+/* Inputs of the batched velocities, one lane per character. The lanes of a run are contiguous so they go through a single UMovementData::CalculateVelocities */
+struct FRadicalMovementVelocityLanes
+{
+	TArray<FVector> Velocities;				// Overwritten with the integrated velocities
+	TArray<FVector> Accelerations;
+	TArray<FVector> Gravities;
+	TArray<FVector> GravityDirs;
+	TArray<float> TerminalVelocities;
+	TArray<EMovementState> MovementStates;
+	TArray<int32> Components;				// Index of the character in the batch
+
+	void SetNum(int32 Num)
+	{
+		Velocities.SetNumUninitialized(Num, false);
+		Accelerations.SetNumUninitialized(Num, false);
+		Gravities.SetNumUninitialized(Num, false);
+		GravityDirs.SetNumUninitialized(Num, false);
+		TerminalVelocities.SetNumUninitialized(Num, false);
+		MovementStates.SetNumUninitialized(Num, false);
+		Components.SetNumUninitialized(Num, false);
+	}
+};
+
+/* Lanes of the characters integrated with the same time step by movement data sharing a velocity model (@see UMovementData::HasSameVelocityModel) */
+struct FRadicalMovementVelocityRun
+{
+	const UMovementData* Data = nullptr;
+	float DeltaTime = 0.f;
+	int32 Start = 0;
+	int32 Num = 0;
+};
+
+/* Capsule of a pawn taking part in the shared pawn repulsion, gathered once per frame */
+struct FPawnRepulsionEntry
+{
+	FVector Location = FVector::ZeroVector;
+	FVector Up = FVector::UpVector;
+	float Radius = 0.f;
+	float HalfHeight = 0.f;
+	float Strength = 0.f;
+	bool bValid = false;
+};
+
+/* Transform & velocities of a movement base, computed once per frame and shared by every pawn based on it */
+struct FMovementBaseState
+{
+	FVector Location = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+	FVector LinearVelocity = FVector::ZeroVector;
+	FVector AngularVelocity = FVector::ZeroVector;		// Radians
+	bool bHasTransform = false;
+
+	/// @brief  Velocity at the given world location due to the rotation of the base
+	FORCEINLINE FVector GetTangentialVelocity(const FVector& WorldLocation) const
+	{
+		return bHasTransform && !AngularVelocity.IsNearlyZero() ? AngularVelocity ^ (WorldLocation - Location) : FVector::ZeroVector;
+	}
+};
+
+/* Move of a movement base since the transform pawns saved of it (@see URadicalMovementComponent::SaveBaseLocation), shared by the pawns that saved the same transform */
+struct FMovementBaseDelta
+{
+	FVector OldLocation = FVector::ZeroVector;
+	FQuat OldRotation = FQuat::Identity;
+	FVector NewLocation = FVector::ZeroVector;
+	FQuat NewRotation = FQuat::Identity;
+	FQuat DeltaRotation = FQuat::Identity;
+	bool bRotationChanged = false;
+	bool bMoved = false;
+	bool bHasTransform = false;
+
+	/// @brief  Where a world location fixed to the base in its old transform is in its new transform
+	FORCEINLINE FVector TransformPosition(const FVector& WorldLocation) const
+	{
+		return NewLocation + DeltaRotation.RotateVector(WorldLocation - OldLocation);
+	}
+};
+
+/**
+ * Ticks every registered URadicalMovementComponent from a single tick function instead of one tick function per component.
+ *
+ * The update of each component is split into phases, every component goes through a phase before the batch moves on to the next one:
+ *	- Pre Tick (Game Thread): Consumes input and runs the skip/physics checks, gathering each component's state and the inputs of its first velocity calculation
+ *	- Integrate (Parallel): Integrates the first velocity of each component, doesn't touch the scene. The inputs are gathered into lanes grouped by
+ *	  velocity model and time step, each group going through UMovementData::CalculateVelocities 4 characters at a time
+ *	- Move (Game Thread): PerformMovement. The first sub-step uses the integrated velocity if its inputs didn't change since they were gathered
+ *	  (see URadicalMovementComponent::ConsumeBatchedVelocity), the following sub-steps interleave velocity calculations with their sweeps
+ *	- Post Tick (Game Thread): Applies physics interactions and debug
+ *
+ * Components opt in through URadicalMovementComponent::bAllowBatchedMovement and register on BeginPlay while rmc.BatchedMovement is enabled.
+ *
+ * Also owns the spatial hash of pawn capsules used for pawn repulsion (URadicalMovementComponent::bEnablePawnRepulsion), independently of batching.
+ * It's rebuilt and solved for every pawn on the first request of a frame, so pawns are separated without relying on overlap events.
+ *
+ * Movement base transforms, velocities and their move since the last update are cached per base each frame, so the pawns sharing a base (e.g crowded
+ * platforms or trains) don't each query them or work out the move of the base on their own.
+ */
+UCLASS()
+class COREFRAMEWORK_API URadicalMovementSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+	friend struct FRadicalMovementBatchTickFunction;
+
+public:
+	// BEGIN USubsystem Interface
+	virtual void Deinitialize() override;
+	// END USubsystem Interface
+
+	/// @brief  Whether components beginning play should register with the batch (rmc.BatchedMovement)
+	static bool IsBatchingEnabled();
+
+	/// @brief  Takes over the tick of the component, disabling its own tick function. Returns false if it couldn't be registered
+	bool RegisterComponent(URadicalMovementComponent* Component);
+
+	/// @brief  Hands the tick back to the component
+	void UnregisterComponent(URadicalMovementComponent* Component);
+
+	/// @brief  Makes the batch tick after the movement base, dependencies are counted since they are shared between every batched component
+	void AddBaseTickDependency(UPrimitiveComponent* MovementBase);
+
+	/// @brief  Removes a dependency added with AddBaseTickDependency once no batched component depends on the base anymore
+	void RemoveBaseTickDependency(UPrimitiveComponent* MovementBase);
+
+	FORCEINLINE FTickFunction& GetBatchTickFunction() { return BatchTickFunction; }
+
+	FORCEINLINE int32 GetNumComponents() const { return Components.Num(); }
+
+	/// @brief  Number of velocities integrated ahead by the batch, and how many of them the updates used (the rest had their inputs change on the way)
+	FORCEINLINE void GetBatchedVelocityCounts(uint64& OutGathered, uint64& OutUsed) const { OutGathered = NumBatchedVelocitiesGathered; OutUsed = NumBatchedVelocitiesUsed; }
+
+	/// @brief  Adds the component to the shared pawn repulsion hash
+	void RegisterRepulsionComponent(URadicalMovementComponent* Component);
+
+	void UnregisterRepulsionComponent(URadicalMovementComponent* Component);
+
+	/// @brief  Repulsion acceleration pushing the component away from the pawns overlapping it, solved for every registered pawn on the first request of the frame
+	FVector GetPawnRepulsion(const URadicalMovementComponent* Component);
+
+	/// @brief  State of the movement base this frame, computed on the first request and shared by every pawn based on it.
+	///			Simulated bases and bone bases are computed on every request since physics or animation can move them without the cache noticing
+	FMovementBaseState GetMovementBaseState(const UPrimitiveComponent* MovementBase, FName BoneName);
+
+	/// @brief  Computes the state of the movement base without going through the cache
+	static FMovementBaseState ComputeMovementBaseState(const UPrimitiveComponent* MovementBase, FName BoneName);
+
+	/// @brief  Move of the movement base since the given saved transform. Pawns saving the same transform (every pawn that updated on the base
+	///			last frame) share the move computed by the first of them. Bypasses the cache like GetMovementBaseState
+	FMovementBaseDelta GetMovementBaseDelta(const UPrimitiveComponent* MovementBase, FName BoneName, const FVector& OldLocation, const FQuat& OldRotation);
+
+	/// @brief  Computes the move of a base from the given saved transform to its current state
+	static FMovementBaseDelta ComputeMovementBaseDelta(const FMovementBaseState& State, const FVector& OldLocation, const FQuat& OldRotation);
+
+protected:
+	// BEGIN UWorldSubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	// END UWorldSubsystem Interface
+
+	/// @brief  Runs the movement update of every registered component, phase by phase
+	void TickBatch(float DeltaTime, ELevelTick TickType);
+
+	/// @brief  Drops components unregistered during the batch tick
+	void CompactComponents();
+
+	/// @brief  Adds the gathered velocity of the component at the given index to the run of its velocity model & time step
+	void AddBatchedVelocity(int32 Index);
+
+	/// @brief  Lays the gathered velocities out into lanes run by run, then integrates the runs across worker threads
+	void IntegrateBatchedVelocities(int32 NumComponents);
+
+	/// @brief  Gathers the capsule of every repulsion component into the spatial hash, then solves the repulsion of each against its neighbouring cells
+	void UpdatePawnRepulsion();
+
+	struct FMovementBaseCacheEntry;
+	
+	/// @brief  Cache entry of the base holding its current state, null if the base bypasses the cache
+	FMovementBaseCacheEntry* FindMovementBaseCacheEntry(const UPrimitiveComponent* MovementBase, FName BoneName);
+
+	FORCEINLINE static FIntVector GetRepulsionCell(const FVector& Location, float CellSize)
+	{
+		return FIntVector(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize), FMath::FloorToInt(Location.Z / CellSize));
+	}
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<URadicalMovementComponent>> Components;
+
+	/* Matches Components index for index */
+	TArray<FRadicalMovementBatchState> States;
+
+	/* Batched velocities of the frame, the runs are split into jobs of at most VelocityJobSize lanes for the parallel integration */
+	FRadicalMovementVelocityLanes VelocityLanes;
+	TArray<FRadicalMovementVelocityRun> VelocityRuns;
+	TArray<FRadicalMovementVelocityRun> VelocityJobs;
+	static constexpr int32 VelocityJobSize = 64;
+
+	/* Batched velocities gathered & used by the updates since the subsystem started, @see GetBatchedVelocityCounts */
+	uint64 NumBatchedVelocitiesGathered = 0;
+	uint64 NumBatchedVelocitiesUsed = 0;
+
+	/* Number of batched components depending on each movement base */
+	TMap<TWeakObjectPtr<UPrimitiveComponent>, int32> BaseDependencies;
+
+	FRadicalMovementBatchTickFunction BatchTickFunction;
+
+	bool bTickingBatch = false;
+	bool bPendingCompaction = false;
+
+	/* Pawn Repulsion, entries and results match RepulsionComponents index for index */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<URadicalMovementComponent>> RepulsionComponents;
+	
+	TArray<FPawnRepulsionEntry> RepulsionEntries;
+	TArray<FVector> RepulsionResults;
+
+	/* Entry indices grouped by cell, and the (Start, Num) range of each occupied cell within it */
+	TArray<int32> RepulsionCellEntries;
+	TMap<FIntVector, FIntPoint> RepulsionCells;
+
+	float RepulsionCellSize = 0.f;
+	uint64 RepulsionFrame = 0;
+
+	/* Movement Base Cache, flushed every frame. The transform of the base component validates entries against moves happening later in the frame.
+	   The delta is the last move requested of the base, reused while pawns ask for it from the same saved transform */
+	struct FMovementBaseCacheEntry
+	{
+		FMovementBaseState State;
+		FTransform ComponentTransform;
+		FMovementBaseDelta Delta;
+	};
+	TMap<const UPrimitiveComponent*, FMovementBaseCacheEntry> MovementBaseCache;
+	uint64 MovementBaseCacheFrame = 0;
+};
@@ -16,9 +16,9 @@ void FInputWindow_InputBuffer::RenderContent()
 
 	auto IB = UInputBuffer::Get(PC->GetPawn());
 	
-	const TBufferContainer<FBufferFrame> InputData = IB->GetInputBufferData();//InputBuffer->GetInputBufferData();
-	const int numInputs = InputData[0].InputsFrameState.Num();
-	TArray<FGameplayTag> inputIDs; InputData[0].InputsFrameState.GetKeys(inputIDs);
+	const FBufferFrameRing& InputData = IB->GetInputBufferData();//InputBuffer->GetInputBufferData();
+	const TArray<FGameplayTag>& inputIDs = IB->GetBufferedActionIDs();
+	const int numInputs = inputIDs.Num();
 
 	auto flags = ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_BordersV | ImGuiTableFlags_RowBg;
 	if (ImGui::BeginTable("Input Buffer", numInputs, flags))
@@ -36,15 +36,15 @@ void FInputWindow_InputBuffer::RenderContent()
 		// Bump font size for button value, better readability
 		ImGui::SetWindowFontScale(1.5f);
 
-		const int numRows = InputData.GetSize();
+		const int numRows = InputData.NumFrames();
 		for (int i = 0; i < numRows; i++) // rows
 		{
 			ImGui::TableNextRow();
-			for (const FGameplayTag& input : inputIDs) // columns
+			for (int slot = 0; slot < numInputs; slot++) // columns
 			{
 				ImGui::TableNextColumn();
 		
-				const FInputFrameState element = InputData[i].InputsFrameState[input];
+				const FInputFrameState element = InputData.GetFrameState(i, slot);
 				int val = element.HoldTime;
 
 				ImGui::Text("%d", val);
@@ -56,7 +56,7 @@ void FInputWindow_InputBuffer::RenderContent()
 					{
 						colorVal = ImVec4(0.2f, 0.2f, 0.2f, 1.f);
 					}
-					if (element.bUsed)
+					if (IB->IsFrameConsumed(i, slot))
 					{
 						colorVal = ImVec4(0.f, 0.4f, 0.f, 1.f); // Green = Used
 					}